@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+#include <figcone/configreader.h>
+#include <figcone_tree/iparser.h>
+#include <figcone_tree/tree.h>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace {
+
+template<typename TMap>
+struct FeatureFlagsCfg {
+    TMap flags;
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    explicit TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+private:
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+std::unique_ptr<figcone::TreeNode> makeFeatureFlagsTree(int size)
+{
+    auto tree = figcone::makeTreeRoot();
+    auto& flags = tree->asItem().addNode("flags");
+    for (auto i = 0; i < size; ++i)
+        flags.asItem().addParam("feature_flag_" + std::to_string(i), i % 3 ? "enabled" : "disabled");
+    return tree;
+}
+
+template<typename TMap>
+void readFeatureFlags(benchmark::State& state)
+{
+    const auto size = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto parser = TreeProvider{makeFeatureFlagsTree(size)};
+        state.ResumeTiming();
+        auto cfgReader = figcone::ConfigReader{};
+        benchmark::DoNotOptimize(cfgReader.read<FeatureFlagsCfg<TMap>>("", parser));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(readFeatureFlags, std::map<std::string, std::string>)
+        ->Name("dict/map")
+        ->Arg(50000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(readFeatureFlags, std::unordered_map<std::string, std::string>)
+        ->Name("dict/unordered_map")
+        ->Arg(50000)
+        ->Unit(benchmark::kMillisecond);
+
+} //namespace
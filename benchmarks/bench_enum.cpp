@@ -0,0 +1,122 @@
+#include <benchmark/benchmark.h>
+#include <figcone/config.h>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#ifdef FIGCONE_NAMEOF_AVAILABLE
+
+namespace {
+
+#define FIGCONE_BENCHMARK_ENUM_VALUES(X)                                                                               \
+    X(Alpha)                                                                                                           \
+    X(Bravo)                                                                                                           \
+    X(Charlie)                                                                                                         \
+    X(Delta)                                                                                                           \
+    X(Echo)                                                                                                            \
+    X(Foxtrot)                                                                                                         \
+    X(Golf)                                                                                                            \
+    X(Hotel)                                                                                                           \
+    X(India)                                                                                                           \
+    X(Juliett)                                                                                                         \
+    X(Kilo)                                                                                                            \
+    X(Lima)                                                                                                            \
+    X(Mike)                                                                                                            \
+    X(November)                                                                                                        \
+    X(Oscar)                                                                                                           \
+    X(Papa)                                                                                                            \
+    X(Quebec)                                                                                                          \
+    X(Romeo)                                                                                                           \
+    X(Sierra)                                                                                                          \
+    X(Tango)                                                                                                           \
+    X(Uniform)                                                                                                         \
+    X(Victor)                                                                                                          \
+    X(Whiskey)                                                                                                         \
+    X(Xray)                                                                                                            \
+    X(Yankee)                                                                                                          \
+    X(Zulu)                                                                                                            \
+    X(Mercury)                                                                                                         \
+    X(Venus)                                                                                                           \
+    X(Earth)                                                                                                           \
+    X(Mars)                                                                                                            \
+    X(Jupiter)                                                                                                         \
+    X(Saturn)                                                                                                          \
+    X(Uranus)                                                                                                          \
+    X(Neptune)                                                                                                         \
+    X(Pluto)                                                                                                           \
+    X(Ceres)                                                                                                           \
+    X(Eris)                                                                                                            \
+    X(Haumea)                                                                                                          \
+    X(Makemake)                                                                                                        \
+    X(Sedna)                                                                                                           \
+    X(ReadOnly)                                                                                                        \
+    X(ReadWrite)                                                                                                       \
+    X(WriteOnly)                                                                                                       \
+    X(AppendOnly)                                                                                                      \
+    X(DebugLevel)                                                                                                      \
+    X(InfoLevel)                                                                                                       \
+    X(WarningLevel)                                                                                                    \
+    X(ErrorLevel)                                                                                                      \
+    X(FatalLevel)                                                                                                      \
+    X(TraceLevel)                                                                                                      \
+    X(RoundRobin)                                                                                                      \
+    X(LeastConnections)                                                                                                \
+    X(RandomChoice)                                                                                                    \
+    X(WeightedRandom)                                                                                                  \
+    X(ConsistentHash)                                                                                                  \
+    X(PowerOfTwoChoices)                                                                                               \
+    X(HttpOne)                                                                                                         \
+    X(HttpTwo)                                                                                                         \
+    X(HttpThree)                                                                                                       \
+    X(WebSocket)                                                                                                       \
+    X(GrpcStream)                                                                                                      \
+    X(PlainTcp)                                                                                                        \
+    X(PlainUdp)                                                                                                        \
+    X(UnixSocket)
+
+#define FIGCONE_BENCHMARK_ENUMERATOR(name) name,
+enum class Value64 {
+    FIGCONE_BENCHMARK_ENUM_VALUES(FIGCONE_BENCHMARK_ENUMERATOR)
+};
+#undef FIGCONE_BENCHMARK_ENUMERATOR
+
+// The hand-written conversion that is replaced by the built-in enum support
+std::optional<Value64> valueFromIfChain(const std::string& data)
+{
+#define FIGCONE_BENCHMARK_ENUM_COMPARISON(name)                                                                        \
+    if (data == #name)                                                                                                 \
+        return Value64::name;
+    FIGCONE_BENCHMARK_ENUM_VALUES(FIGCONE_BENCHMARK_ENUM_COMPARISON)
+#undef FIGCONE_BENCHMARK_ENUM_COMPARISON
+    return std::nullopt;
+}
+
+std::vector<std::string> enumNames()
+{
+#define FIGCONE_BENCHMARK_ENUM_NAME(name) #name,
+    return {FIGCONE_BENCHMARK_ENUM_VALUES(FIGCONE_BENCHMARK_ENUM_NAME)};
+#undef FIGCONE_BENCHMARK_ENUM_NAME
+}
+
+template<std::optional<Value64> (*convert)(const std::string&)>
+void convertEnumNames(benchmark::State& state)
+{
+    const auto names = enumNames();
+    for (auto _ : state)
+        for (const auto& name : names)
+            benchmark::DoNotOptimize(convert(name));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * names.size()));
+}
+
+std::optional<Value64> valueFromEnumConverter(const std::string& data)
+{
+    return figcone::detail::enumFromString<Value64>(data);
+}
+
+BENCHMARK_TEMPLATE(convertEnumNames, valueFromIfChain)->Name("enum/if_chain/64");
+BENCHMARK_TEMPLATE(convertEnumNames, valueFromEnumConverter)->Name("enum/built_in/64");
+
+} //namespace
+
+#endif
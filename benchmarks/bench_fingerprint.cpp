@@ -0,0 +1,52 @@
+#include "configs.h"
+#include <benchmark/benchmark.h>
+#include <figcone/fingerprint.h>
+#include <string>
+
+namespace {
+using namespace figcone_benchmarks;
+
+template<typename TCfg, typename TRouteCfg>
+TCfg makeLargeCfg(int size)
+{
+    auto cfg = TCfg{};
+    cfg.name = "large";
+    for (auto i = 0; i < size; ++i) {
+        auto route = TRouteCfg{};
+        route.name = "route_" + std::to_string(i);
+        route.backend = "backend_" + std::to_string(i % 16);
+        route.port = 8000 + i % 1000;
+        route.weight = 1.0 / (i + 1);
+        route.enabled = i % 2 == 0;
+        route.methods = {"GET", "POST"};
+        cfg.routes.emplace_back(std::move(route));
+        cfg.featureFlags.emplace("flag_" + std::to_string(i), i % 3 ? "on" : "off");
+    }
+    return cfg;
+}
+
+template<typename TCfg, typename TRouteCfg>
+void fingerprintLargeConfig(benchmark::State& state)
+{
+    const auto cfg = makeLargeCfg<TCfg, TRouteCfg>(static_cast<int>(state.range(0)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(figcone::fingerprint(cfg));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename TCfg, typename TRouteCfg>
+void equalLargeConfigs(benchmark::State& state)
+{
+    const auto cfg = makeLargeCfg<TCfg, TRouteCfg>(static_cast<int>(state.range(0)));
+    const auto cfg2 = makeLargeCfg<TCfg, TRouteCfg>(static_cast<int>(state.range(0)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(figcone::equal(cfg, cfg2));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(fingerprintLargeConfig, LargeCfg, RouteCfg)->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(fingerprintLargeConfig, StaticLargeCfg, StaticRouteCfg)->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(equalLargeConfigs, LargeCfg, RouteCfg)->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(equalLargeConfigs, StaticLargeCfg, StaticRouteCfg)->Arg(1000)->Arg(100000);
+
+} //namespace
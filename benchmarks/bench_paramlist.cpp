@@ -0,0 +1,67 @@
+#include <benchmark/benchmark.h>
+#include <figcone/configreader.h>
+#include <figcone_tree/iparser.h>
+#include <figcone_tree/tree.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+template<typename T>
+struct WeightTableCfg {
+    std::vector<T> weights;
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    explicit TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+private:
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+template<typename T>
+std::unique_ptr<figcone::TreeNode> makeWeightTableTree(int size)
+{
+    auto weights = std::vector<std::string>{};
+    weights.reserve(size);
+    for (auto i = 0; i < size; ++i) {
+        if constexpr (std::is_floating_point_v<T>)
+            weights.emplace_back(std::to_string(i * 0.125 - 1000.5));
+        else
+            weights.emplace_back(std::to_string(i * 7919 - 1000000));
+    }
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParamList("weights", std::move(weights));
+    return tree;
+}
+
+template<typename T>
+void readWeightTable(benchmark::State& state)
+{
+    const auto size = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto parser = TreeProvider{makeWeightTableTree<T>(size)};
+        state.ResumeTiming();
+        auto cfgReader = figcone::ConfigReader{};
+        benchmark::DoNotOptimize(cfgReader.read<WeightTableCfg<T>>("", parser));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(readWeightTable, std::int64_t)->Name("paramlist/int64")->Arg(1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(readWeightTable, double)->Name("paramlist/double")->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+} //namespace
@@ -0,0 +1,10 @@
+#include "configs.h"
+#include "readbenchmark.h"
+#include "../examples/demo.h"
+
+namespace {
+using namespace figcone_benchmarks;
+
+const auto isRegistered = registerReadBenchmarks<PhotoViewerCfg, LargeCfg>("runtime_refl");
+
+} //namespace
@@ -0,0 +1,11 @@
+#define FIGCONE_EXAMPLE_STATIC_REFLECTION
+#include "configs.h"
+#include "readbenchmark.h"
+#include "../examples/demo.h"
+
+namespace {
+using namespace figcone_benchmarks;
+
+const auto isRegistered = registerReadBenchmarks<PhotoViewerCfg, StaticLargeCfg>("static_refl");
+
+} //namespace
@@ -0,0 +1,76 @@
+#include "documents.h"
+#include <benchmark/benchmark.h>
+#include <figcone/configreader.h>
+#include <figcone_configgen/generator.h>
+#include <figcone_configgen/writer.h>
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+namespace {
+using namespace figcone_benchmarks;
+
+template<typename TParser>
+void parseDocument(benchmark::State& state, const figcone::configgen::Shape& shape, Format format)
+{
+    const auto document = figcone::configgen::write(figcone::configgen::generate(shape, 0), format);
+    for (auto _ : state) {
+        auto stream = std::stringstream{document};
+        auto parser = TParser{};
+        auto tree = parser.parse(stream);
+        benchmark::DoNotOptimize(tree);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * document.size()));
+}
+
+// Registers benchmarks of parsing documents with the same generated content in every enabled format
+void registerScalingBenchmark(const std::string& shapeName, const figcone::configgen::Shape& shape)
+{
+    [[maybe_unused]] const auto registerFormat = [&](Format format, auto parseFunc)
+    {
+        const auto name = "parse/" + formatName(format) + "/" + shapeName;
+        benchmark::RegisterBenchmark(name.c_str(), parseFunc, shape, format)->Unit(benchmark::kMicrosecond);
+    };
+#ifdef FIGCONE_JSON_AVAILABLE
+    registerFormat(Format::Json, parseDocument<figcone::json::Parser>);
+#endif
+#ifdef FIGCONE_YAML_AVAILABLE
+    registerFormat(Format::Yaml, parseDocument<figcone::yaml::Parser>);
+#endif
+#ifdef FIGCONE_TOML_AVAILABLE
+    registerFormat(Format::Toml, parseDocument<figcone::toml::Parser>);
+#endif
+#ifdef FIGCONE_INI_AVAILABLE
+    registerFormat(Format::Ini, parseDocument<figcone::ini::Parser>);
+#endif
+#ifdef FIGCONE_XML_AVAILABLE
+    registerFormat(Format::Xml, parseDocument<figcone::xml::Parser>);
+#endif
+#ifdef FIGCONE_SHOAL_AVAILABLE
+    registerFormat(Format::Shoal, parseDocument<figcone::shoal::Parser>);
+#endif
+}
+
+figcone::configgen::Shape makeShape(int depth, int width, int nodeListLength)
+{
+    auto shape = figcone::configgen::Shape{};
+    shape.depth = depth;
+    shape.width = width;
+    shape.nodeListLength = nodeListLength;
+    return shape;
+}
+
+bool registerScalingBenchmarks()
+{
+    for (auto depth : {1, 4, 8})
+        registerScalingBenchmark("depth_" + std::to_string(depth), makeShape(depth, 4, 1));
+    for (auto width : {10, 100, 1000})
+        registerScalingBenchmark("width_" + std::to_string(width), makeShape(1, width, 1));
+    for (auto length : {10, 1000, 100000})
+        registerScalingBenchmark("node_list_" + std::to_string(length), makeShape(1, 4, length));
+    return true;
+}
+
+const auto isRegistered = registerScalingBenchmarks();
+
+} //namespace
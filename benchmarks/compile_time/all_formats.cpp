@@ -0,0 +1,2 @@
+#include <figcone/configreader.h>
+#include "readconfig.h"
@@ -0,0 +1 @@
+#include <figcone/configreadercore.h>
@@ -0,0 +1,2 @@
+#include <figcone/configreadercore.h>
+#include "readconfig.h"
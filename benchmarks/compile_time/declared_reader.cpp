@@ -0,0 +1,3 @@
+#define FIGCONE_BENCHMARKS_DECLARE_READER
+#include <figcone/configreadercore.h>
+#include "readconfig.h"
@@ -0,0 +1,2 @@
+#include <figcone/inireader.h>
+#include "readconfig.h"
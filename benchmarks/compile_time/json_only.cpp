@@ -0,0 +1,2 @@
+#include <figcone/jsonreader.h>
+#include "readconfig.h"
@@ -0,0 +1,66 @@
+# Preprocesses and compiles each of the SOURCES and reports the size of the preprocessed output, the compilation time
+# and the size of the resulting object file.
+# The list arguments are separated with '|' to be passed through the command line.
+cmake_minimum_required(VERSION 3.23)
+
+string(REPLACE "|" ";" SOURCES "${SOURCES}")
+string(REPLACE "|" ";" INCLUDE_DIRS "${INCLUDE_DIRS}")
+string(REPLACE "|" ";" DEFINITIONS "${DEFINITIONS}")
+if (NOT REPETITIONS)
+    set(REPETITIONS 3)
+endif ()
+
+set(COMPILE_FLAGS ${STANDARD_FLAG})
+foreach (INCLUDE_DIR ${INCLUDE_DIRS})
+    list(APPEND COMPILE_FLAGS "-I${INCLUDE_DIR}")
+endforeach ()
+foreach (DEFINITION ${DEFINITIONS})
+    list(APPEND COMPILE_FLAGS "-D${DEFINITION}")
+endforeach ()
+
+function(timestamp_ms RESULT)
+    string(TIMESTAMP MICROSECONDS "%s%f")
+    math(EXPR MILLISECONDS "${MICROSECONDS} / 1000")
+    set(${RESULT} ${MILLISECONDS} PARENT_SCOPE)
+endfunction()
+
+set(OBJECT_FILE ${CMAKE_CURRENT_BINARY_DIR}/figcone_compile_time_benchmark.o)
+
+message("| Source | Preprocessed lines | Preprocessed bytes | Compilation time, ms | Object size, bytes |")
+message("|--------|-------------------:|-------------------:|---------------------:|-------------------:|")
+foreach (SOURCE ${SOURCES})
+    execute_process(
+            COMMAND ${COMPILER} ${COMPILE_FLAGS} -E ${SOURCE}
+            OUTPUT_VARIABLE PREPROCESSED
+            RESULT_VARIABLE RESULT
+    )
+    if (NOT RESULT EQUAL 0)
+        message(FATAL_ERROR "Failed to preprocess ${SOURCE}")
+    endif ()
+    string(LENGTH "${PREPROCESSED}" PREPROCESSED_BYTES)
+    string(REGEX REPLACE "[^\n]" "" NEWLINES "${PREPROCESSED}")
+    string(LENGTH "${NEWLINES}" PREPROCESSED_LINES)
+
+    set(BEST_TIME "")
+    foreach (REPETITION RANGE 1 ${REPETITIONS})
+        timestamp_ms(START_TIME)
+        execute_process(
+                COMMAND ${COMPILER} ${COMPILE_FLAGS} -c ${SOURCE} -o ${OBJECT_FILE}
+                RESULT_VARIABLE RESULT
+        )
+        timestamp_ms(END_TIME)
+        if (NOT RESULT EQUAL 0)
+            message(FATAL_ERROR "Failed to compile ${SOURCE}")
+        endif ()
+        math(EXPR TIME "${END_TIME} - ${START_TIME}")
+        if (BEST_TIME STREQUAL "" OR TIME LESS BEST_TIME)
+            set(BEST_TIME ${TIME})
+        endif ()
+    endforeach ()
+
+    file(SIZE ${OBJECT_FILE} OBJECT_SIZE)
+
+    get_filename_component(SOURCE_NAME ${SOURCE} NAME)
+    message("| ${SOURCE_NAME} | ${PREPROCESSED_LINES} | ${PREPROCESSED_BYTES} | ${BEST_TIME} | ${OBJECT_SIZE} |")
+endforeach ()
+file(REMOVE ${OBJECT_FILE})
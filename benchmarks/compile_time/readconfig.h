@@ -0,0 +1,84 @@
+#pragma once
+#include <figcone/config.h>
+#include <string>
+#include <vector>
+
+// Shared code of the measured translation units, included after the reader header that is measured.
+// The functions aren't inline to make the compiler generate code of the used reader templates.
+namespace figcone_benchmarks {
+
+struct ServerCfg : public figcone::Config {
+    FIGCONE_PARAM(host, std::string);
+    FIGCONE_PARAM(port, int);
+    FIGCONE_PARAMLIST(aliases, std::vector<std::string>)();
+};
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(name, std::string);
+    FIGCONE_NODE(server, ServerCfg);
+    FIGCONE_NODELIST(mirrors, std::vector<ServerCfg>)();
+};
+
+} //namespace figcone_benchmarks
+
+#ifdef FIGCONE_BENCHMARKS_DECLARE_READER
+FIGCONE_DECLARE_READER(figcone_benchmarks::Cfg);
+#endif
+
+namespace figcone_benchmarks {
+
+Cfg readConfig(const std::string& configContent, figcone::IParser& parser)
+{
+    auto cfgReader = figcone::ConfigReader{};
+    return cfgReader.read<Cfg>(configContent, parser);
+}
+
+#ifdef FIGCONE_JSON_AVAILABLE
+Cfg readJsonConfig(const std::string& configContent)
+{
+    auto cfgReader = figcone::ConfigReader{};
+    return cfgReader.readJson<Cfg>(configContent);
+}
+#endif
+
+#ifdef FIGCONE_YAML_AVAILABLE
+Cfg readYamlConfig(const std::string& configContent)
+{
+    auto cfgReader = figcone::ConfigReader{};
+    return cfgReader.readYaml<Cfg>(configContent);
+}
+#endif
+
+#ifdef FIGCONE_TOML_AVAILABLE
+Cfg readTomlConfig(const std::string& configContent)
+{
+    auto cfgReader = figcone::ConfigReader{};
+    return cfgReader.readToml<Cfg>(configContent);
+}
+#endif
+
+#ifdef FIGCONE_XML_AVAILABLE
+Cfg readXmlConfig(const std::string& configContent)
+{
+    auto cfgReader = figcone::ConfigReader{};
+    return cfgReader.readXml<Cfg>(configContent);
+}
+#endif
+
+#ifdef FIGCONE_INI_AVAILABLE
+Cfg readIniConfig(const std::string& configContent)
+{
+    auto cfgReader = figcone::ConfigReader{};
+    return cfgReader.readIni<Cfg>(configContent);
+}
+#endif
+
+#ifdef FIGCONE_SHOAL_AVAILABLE
+Cfg readShoalConfig(const std::string& configContent)
+{
+    auto cfgReader = figcone::ConfigReader{};
+    return cfgReader.readShoal<Cfg>(configContent);
+}
+#endif
+
+} //namespace figcone_benchmarks
@@ -0,0 +1,2 @@
+#include <figcone/shoalreader.h>
+#include "readconfig.h"
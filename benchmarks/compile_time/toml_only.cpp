@@ -0,0 +1,2 @@
+#include <figcone/tomlreader.h>
+#include "readconfig.h"
@@ -0,0 +1,2 @@
+#include <figcone/xmlreader.h>
+#include "readconfig.h"
@@ -0,0 +1,2 @@
+#include <figcone/yamlreader.h>
+#include "readconfig.h"
@@ -0,0 +1,41 @@
+#pragma once
+#include <figcone/config.h>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace figcone_benchmarks {
+
+using StringMap = std::map<std::string, std::string>;
+
+struct RouteCfg : public figcone::Config {
+    FIGCONE_PARAM(name, std::string);
+    FIGCONE_PARAM(backend, std::string);
+    FIGCONE_PARAM(port, int);
+    FIGCONE_PARAM(weight, double);
+    FIGCONE_PARAM(enabled, bool);
+    FIGCONE_PARAMLIST(methods, std::vector<std::string>);
+};
+
+struct LargeCfg : public figcone::Config {
+    FIGCONE_PARAM(name, std::string);
+    FIGCONE_NODELIST(routes, std::vector<RouteCfg>);
+    FIGCONE_DICT(featureFlags, StringMap);
+};
+
+struct StaticRouteCfg {
+    std::string name;
+    std::string backend;
+    int port;
+    double weight;
+    bool enabled;
+    std::vector<std::string> methods;
+};
+
+struct StaticLargeCfg {
+    std::string name;
+    std::vector<StaticRouteCfg> routes;
+    std::map<std::string, std::string> featureFlags;
+};
+
+} //namespace figcone_benchmarks
@@ -0,0 +1,35 @@
+#pragma once
+#include <figcone_configgen/generator.h>
+#include <figcone_configgen/writer.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace figcone_benchmarks {
+
+using figcone::configgen::Format;
+using figcone::configgen::formatName;
+
+// Returns the content of the examples/demo.<format> file matching the PhotoViewerCfg structure from examples/demo.h
+inline std::string readExampleDocument(Format format)
+{
+    auto file = std::ifstream{std::filesystem::path{FIGCONE_EXAMPLES_DIR} / ("demo." + formatName(format))};
+    auto stream = std::stringstream{};
+    stream << file.rdbuf();
+    return stream.str();
+}
+
+// Returns a generated document matching the TCfg structure, where every node list, parameter list and dictionary
+// has the specified number of elements. Documents of all formats have the same content.
+template<typename TCfg>
+std::string makeLargeDocument(Format format, int size)
+{
+    auto shape = figcone::configgen::Shape{};
+    shape.nodeListLength = size;
+    shape.paramListLength = 2;
+    shape.dictSize = size;
+    return figcone::configgen::write(figcone::configgen::generate<TCfg>(shape, 0), format);
+}
+
+} //namespace figcone_benchmarks
@@ -0,0 +1,121 @@
+#pragma once
+#include "documents.h"
+#include <benchmark/benchmark.h>
+#include <figcone/configreader.h>
+#include <figcone_tree/iparser.h>
+#include <figcone_tree/tree.h>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <sstream>
+#include <string>
+
+namespace figcone_benchmarks {
+
+class ParsedTree : public figcone::IParser {
+public:
+    explicit ParsedTree(figcone::Tree tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(*tree_);
+    }
+
+private:
+    std::optional<figcone::Tree> tree_;
+};
+
+// Reads a config the same way as the ConfigReader::read* methods do, but measures the parsing of the document
+// and the binding of the resulting tree to the config structure separately. Total read time is reported as the
+// benchmark iteration time.
+template<typename TCfg, typename TParser>
+void readConfig(benchmark::State& state, const std::function<std::string()>& makeDocument)
+{
+    using Clock = std::chrono::steady_clock;
+    const auto document = makeDocument();
+    auto parseTime = std::chrono::duration<double>{};
+    auto bindTime = std::chrono::duration<double>{};
+    for (auto _ : state) {
+        auto stream = std::stringstream{document};
+        auto parser = TParser{};
+        auto cfgReader = figcone::ConfigReader{};
+        const auto parseStart = Clock::now();
+        auto parsedTree = ParsedTree{parser.parse(stream)};
+        const auto bindStart = Clock::now();
+        auto cfg = cfgReader.read<TCfg>("", parsedTree);
+        const auto bindEnd = Clock::now();
+        benchmark::DoNotOptimize(cfg);
+        parseTime += bindStart - parseStart;
+        bindTime += bindEnd - bindStart;
+    }
+    state.counters["parse"] = benchmark::Counter{parseTime.count(), benchmark::Counter::kAvgIterations};
+    state.counters["bind"] = benchmark::Counter{bindTime.count(), benchmark::Counter::kAvgIterations};
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * document.size()));
+}
+
+template<typename TCfg>
+void registerReadBenchmark(
+        const std::string& reflectionName,
+        const std::string& sizeName,
+        const std::function<std::string(Format)>& makeDocument)
+{
+    [[maybe_unused]] const auto registerFormat = [&](Format format, auto readFunc)
+    {
+        const auto name = "read/" + formatName(format) + "/" + reflectionName + "/" + sizeName;
+        benchmark::RegisterBenchmark(
+                name.c_str(),
+                readFunc,
+                [=]
+                {
+                    return makeDocument(format);
+                })
+                ->Unit(benchmark::kMicrosecond);
+    };
+#ifdef FIGCONE_JSON_AVAILABLE
+    registerFormat(Format::Json, readConfig<TCfg, figcone::json::Parser>);
+#endif
+#ifdef FIGCONE_YAML_AVAILABLE
+    registerFormat(Format::Yaml, readConfig<TCfg, figcone::yaml::Parser>);
+#endif
+#ifdef FIGCONE_TOML_AVAILABLE
+    registerFormat(Format::Toml, readConfig<TCfg, figcone::toml::Parser>);
+#endif
+#ifdef FIGCONE_INI_AVAILABLE
+    registerFormat(Format::Ini, readConfig<TCfg, figcone::ini::Parser>);
+#endif
+#ifdef FIGCONE_XML_AVAILABLE
+    registerFormat(Format::Xml, readConfig<TCfg, figcone::xml::Parser>);
+#endif
+#ifdef FIGCONE_SHOAL_AVAILABLE
+    registerFormat(Format::Shoal, readConfig<TCfg, figcone::shoal::Parser>);
+#endif
+}
+
+// Registers benchmarks of reading small (examples/demo.*), medium and large generated documents in every enabled
+// format
+template<typename TSmallCfg, typename TLargeCfg>
+bool registerReadBenchmarks(const std::string& reflectionName)
+{
+    registerReadBenchmark<TSmallCfg>(reflectionName, "small", readExampleDocument);
+    registerReadBenchmark<TLargeCfg>(
+            reflectionName,
+            "medium",
+            [](Format format)
+            {
+                return makeLargeDocument<TLargeCfg>(format, 100);
+            });
+    registerReadBenchmark<TLargeCfg>(
+            reflectionName,
+            "large",
+            [](Format format)
+            {
+                return makeLargeDocument<TLargeCfg>(format, 100000);
+            });
+    return true;
+}
+
+} //namespace figcone_benchmarks
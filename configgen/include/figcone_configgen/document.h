@@ -0,0 +1,45 @@
+#ifndef FIGCONE_CONFIGGEN_DOCUMENT_H
+#define FIGCONE_CONFIGGEN_DOCUMENT_H
+
+#include <string>
+#include <vector>
+
+namespace figcone::configgen {
+
+enum class ValueType {
+    Bool,
+    Integer,
+    Real,
+    String
+};
+
+enum class FieldType {
+    Param,
+    ParamList,
+    Node,
+    NodeList,
+    Dict
+};
+
+struct Node;
+
+// Format independent description of a generated config field
+struct Field {
+    std::string name;
+    FieldType type;
+    ValueType valueType = ValueType::String;
+    // Value of a parameter, elements of a parameter list or values of a dictionary
+    std::vector<std::string> values;
+    // Keys of a dictionary
+    std::vector<std::string> keys;
+    // Nested node or elements of a node list
+    std::vector<Node> nodes;
+};
+
+struct Node {
+    std::vector<Field> fields;
+};
+
+} //namespace figcone::configgen
+
+#endif //FIGCONE_CONFIGGEN_DOCUMENT_H
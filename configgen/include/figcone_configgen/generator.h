@@ -0,0 +1,178 @@
+#ifndef FIGCONE_CONFIGGEN_GENERATOR_H
+#define FIGCONE_CONFIGGEN_GENERATOR_H
+
+#include "document.h"
+#include "random.h"
+#include <figcone/config.h>
+#include <figcone/configschema.h>
+#include <figcone/fieldschema.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace figcone::configgen {
+
+struct Shape {
+    // Levels of nested nodes below the root node
+    int depth = 2;
+    // Parameters in each node
+    int width = 4;
+    // Nested nodes in each node above the deepest level
+    int nodeCount = 1;
+    // Elements of a node list in each node above the deepest level, 0 disables node lists
+    int nodeListLength = 2;
+    // Elements of a parameter list in each node, 0 disables parameter lists
+    int paramListLength = 3;
+    // Elements of a dictionary in each node, 0 disables dictionaries
+    int dictSize = 2;
+    // Value types of parameters, parameter lists and dictionaries are picked from this list cyclically
+    std::vector<ValueType> valueTypes = {ValueType::Integer, ValueType::Real, ValueType::Bool, ValueType::String};
+};
+
+namespace detail {
+
+inline std::string generateValue(ValueType valueType, Random& random)
+{
+    switch (valueType) {
+    case ValueType::Bool:
+        return random.next(2) ? "1" : "0";
+    case ValueType::Integer:
+        return std::to_string(random.next(100000));
+    case ValueType::Real: {
+        auto fraction = std::to_string(random.next(1000));
+        return std::to_string(random.next(1000)) + "." + std::string(3 - fraction.size(), '0') + fraction;
+    }
+    case ValueType::String:
+        return "value_" + std::to_string(random.next(1000000));
+    }
+    return {};
+}
+
+inline Field generateParam(std::string name, ValueType valueType, Random& random)
+{
+    return {std::move(name), FieldType::Param, valueType, {generateValue(valueType, random)}, {}, {}};
+}
+
+inline Field generateParamList(std::string name, ValueType valueType, int size, Random& random)
+{
+    auto field = Field{std::move(name), FieldType::ParamList, valueType, {}, {}, {}};
+    for (auto i = 0; i < size; ++i)
+        field.values.emplace_back(generateValue(valueType, random));
+    return field;
+}
+
+inline Field generateDict(std::string name, ValueType valueType, int size, Random& random)
+{
+    auto field = Field{std::move(name), FieldType::Dict, valueType, {}, {}, {}};
+    for (auto i = 0; i < size; ++i) {
+        field.keys.emplace_back("key_" + std::to_string(i));
+        field.values.emplace_back(generateValue(valueType, random));
+    }
+    return field;
+}
+
+inline Node generateNode(const Shape& shape, int level, Random& random)
+{
+    const auto valueType = [&](int index)
+    {
+        return shape.valueTypes[static_cast<std::size_t>(index) % shape.valueTypes.size()];
+    };
+
+    auto node = Node{};
+    for (auto i = 0; i < shape.width; ++i)
+        node.fields.emplace_back(generateParam("param_" + std::to_string(i), valueType(i), random));
+    if (shape.paramListLength > 0)
+        node.fields.emplace_back(generateParamList("list", valueType(shape.width), shape.paramListLength, random));
+    if (shape.dictSize > 0)
+        node.fields.emplace_back(generateDict("dict", valueType(shape.width + 1), shape.dictSize, random));
+    if (level == shape.depth)
+        return node;
+
+    for (auto i = 0; i < shape.nodeCount; ++i)
+        node.fields.push_back(
+                {"node_" + std::to_string(i), FieldType::Node, {}, {}, {}, {generateNode(shape, level + 1, random)}});
+    if (shape.nodeListLength > 0) {
+        auto field = Field{"items", FieldType::NodeList, {}, {}, {}, {}};
+        for (auto i = 0; i < shape.nodeListLength; ++i)
+            field.nodes.emplace_back(generateNode(shape, level + 1, random));
+        node.fields.emplace_back(std::move(field));
+    }
+    return node;
+}
+
+inline ValueType toValueType(figcone::FieldValueType valueType)
+{
+    switch (valueType) {
+    case figcone::FieldValueType::Bool:
+        return ValueType::Bool;
+    case figcone::FieldValueType::Integer:
+        return ValueType::Integer;
+    case figcone::FieldValueType::Real:
+        return ValueType::Real;
+    default:
+        return ValueType::String;
+    }
+}
+
+inline Node generateNode(figcone::ConfigSchema schema, const Shape& shape, int level, Random& random)
+{
+    auto node = Node{};
+    for (const auto& schemaField : schema) {
+        const auto name = std::string{schemaField.name};
+        const auto valueType = toValueType(schemaField.valueType);
+        switch (schemaField.kind) {
+        case figcone::FieldKind::Param:
+            node.fields.emplace_back(generateParam(name, valueType, random));
+            break;
+        case figcone::FieldKind::ParamList:
+            node.fields.emplace_back(generateParamList(name, valueType, shape.paramListLength, random));
+            break;
+        case figcone::FieldKind::Dict:
+            node.fields.emplace_back(generateDict(name, valueType, shape.dictSize, random));
+            break;
+        case figcone::FieldKind::Node:
+            node.fields.push_back(
+                    {name,
+                     FieldType::Node,
+                     {},
+                     {},
+                     {},
+                     {generateNode(schemaField.nestedSchema(), shape, level + 1, random)}});
+            break;
+        case figcone::FieldKind::NodeList: {
+            if (level == shape.depth || shape.nodeListLength <= 0)
+                break;
+            auto field = Field{name, FieldType::NodeList, {}, {}, {}, {}};
+            for (auto i = 0; i < shape.nodeListLength; ++i)
+                field.nodes.emplace_back(generateNode(schemaField.nestedSchema(), shape, level + 1, random));
+            node.fields.emplace_back(std::move(field));
+            break;
+        }
+        }
+    }
+    return node;
+}
+
+} //namespace detail
+
+// Generates a document with the structure described by the shape.
+// The same shape and seed always produce the same document.
+inline Node generate(const Shape& shape, std::uint64_t seed)
+{
+    auto random = Random{seed};
+    return detail::generateNode(shape, 0, random);
+}
+
+// Generates a document that can be read into the config structure TCfg.
+// The lengths of node lists, parameter lists and dictionaries are taken from the shape, node lists nested deeper than
+// shape.depth levels are omitted. Parameters of user defined types are generated as strings.
+template<typename TCfg>
+Node generate(const Shape& shape, std::uint64_t seed)
+{
+    auto random = Random{seed};
+    return detail::generateNode(figcone::schema<TCfg>(), shape, 0, random);
+}
+
+} //namespace figcone::configgen
+
+#endif //FIGCONE_CONFIGGEN_GENERATOR_H
@@ -0,0 +1,37 @@
+#ifndef FIGCONE_CONFIGGEN_RANDOM_H
+#define FIGCONE_CONFIGGEN_RANDOM_H
+
+#include <cstdint>
+
+namespace figcone::configgen {
+
+// SplitMix64 generator. Unlike the standard library distributions, it produces the same sequence on every platform,
+// so generated documents depend only on the seed.
+class Random {
+public:
+    explicit Random(std::uint64_t seed)
+        : state_{seed}
+    {
+    }
+
+    std::uint64_t next()
+    {
+        auto result = (state_ += 0x9e3779b97f4a7c15ull);
+        result = (result ^ (result >> 30)) * 0xbf58476d1ce4e5b9ull;
+        result = (result ^ (result >> 27)) * 0x94d049bb133111ebull;
+        return result ^ (result >> 31);
+    }
+
+    // Returns a value in the range [0, bound)
+    std::uint64_t next(std::uint64_t bound)
+    {
+        return next() % bound;
+    }
+
+private:
+    std::uint64_t state_;
+};
+
+} //namespace figcone::configgen
+
+#endif //FIGCONE_CONFIGGEN_RANDOM_H
@@ -0,0 +1,360 @@
+#ifndef FIGCONE_CONFIGGEN_WRITER_H
+#define FIGCONE_CONFIGGEN_WRITER_H
+
+#include "document.h"
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace figcone::configgen {
+
+enum class Format {
+    Json,
+    Yaml,
+    Toml,
+    Ini,
+    Xml,
+    Shoal
+};
+
+inline const std::vector<Format>& allFormats()
+{
+    static const auto formats =
+            std::vector<Format>{Format::Json, Format::Yaml, Format::Toml, Format::Ini, Format::Xml, Format::Shoal};
+    return formats;
+}
+
+inline std::string formatName(Format format)
+{
+    switch (format) {
+    case Format::Json:
+        return "json";
+    case Format::Yaml:
+        return "yaml";
+    case Format::Toml:
+        return "toml";
+    case Format::Ini:
+        return "ini";
+    case Format::Xml:
+        return "xml";
+    case Format::Shoal:
+        return "shoal";
+    }
+    return {};
+}
+
+inline std::optional<Format> formatFromName(const std::string& name)
+{
+    for (auto format : allFormats())
+        if (formatName(format) == name)
+            return format;
+    return std::nullopt;
+}
+
+namespace detail {
+
+inline bool isParamField(const Field& field)
+{
+    return field.type == FieldType::Param || field.type == FieldType::ParamList;
+}
+
+inline std::string indent(int level)
+{
+    return std::string(static_cast<std::size_t>(level) * 2, ' ');
+}
+
+// Values of all types are quoted, as non-string JSON values are converted to strings before reading
+inline std::string jsonValue(const std::string& value)
+{
+    return "\"" + value + "\"";
+}
+
+inline std::string textValue(ValueType valueType, const std::string& value)
+{
+    if (valueType == ValueType::String)
+        return "\"" + value + "\"";
+    return value;
+}
+
+inline std::string textValueList(const Field& field)
+{
+    auto result = std::string{"["};
+    for (auto i = std::size_t{}; i < field.values.size(); ++i) {
+        result += i ? ", " : "";
+        result += textValue(field.valueType, field.values[i]);
+    }
+    return result + "]";
+}
+
+inline std::string xmlValueList(const Field& field)
+{
+    auto result = std::string{"["};
+    for (auto i = std::size_t{}; i < field.values.size(); ++i)
+        result += (i ? ", '" : "'") + field.values[i] + "'";
+    return result + "]";
+}
+
+inline void writeJsonNode(std::string& doc, const Node& node, int level)
+{
+    doc += "{\n";
+    for (auto fieldIndex = std::size_t{}; fieldIndex < node.fields.size(); ++fieldIndex) {
+        const auto& field = node.fields[fieldIndex];
+        doc += indent(level + 1) + jsonValue(field.name) + ": ";
+        switch (field.type) {
+        case FieldType::Param:
+            doc += jsonValue(field.values.front());
+            break;
+        case FieldType::ParamList:
+            doc += "[";
+            for (auto i = std::size_t{}; i < field.values.size(); ++i) {
+                doc += i ? ", " : "";
+                doc += jsonValue(field.values[i]);
+            }
+            doc += "]";
+            break;
+        case FieldType::Dict:
+            doc += "{";
+            for (auto i = std::size_t{}; i < field.values.size(); ++i) {
+                doc += i ? ", " : "";
+                doc += jsonValue(field.keys[i]) + ": " + jsonValue(field.values[i]);
+            }
+            doc += "}";
+            break;
+        case FieldType::Node:
+            writeJsonNode(doc, field.nodes.front(), level + 1);
+            break;
+        case FieldType::NodeList:
+            doc += "[\n";
+            for (auto i = std::size_t{}; i < field.nodes.size(); ++i) {
+                doc += indent(level + 2);
+                writeJsonNode(doc, field.nodes[i], level + 2);
+                doc += i + 1 < field.nodes.size() ? ",\n" : "\n";
+            }
+            doc += indent(level + 1) + "]";
+            break;
+        }
+        doc += fieldIndex + 1 < node.fields.size() ? ",\n" : "\n";
+    }
+    doc += indent(level) + "}";
+}
+
+inline void writeYamlNode(std::string& doc, const Node& node, int level)
+{
+    for (const auto& field : node.fields) {
+        doc += indent(level) + field.name + ":";
+        switch (field.type) {
+        case FieldType::Param:
+            doc += " ";
+            doc += textValue(field.valueType, field.values.front()) + "\n";
+            break;
+        case FieldType::ParamList:
+            doc += " ";
+            doc += textValueList(field) + "\n";
+            break;
+        case FieldType::Dict:
+            if (field.values.empty())
+                doc += " {}";
+            doc += "\n";
+            for (auto i = std::size_t{}; i < field.values.size(); ++i)
+                doc += indent(level + 1) + field.keys[i] + ": " + textValue(field.valueType, field.values[i]) + "\n";
+            break;
+        case FieldType::Node:
+            if (field.nodes.front().fields.empty())
+                doc += " {}";
+            doc += "\n";
+            writeYamlNode(doc, field.nodes.front(), level + 1);
+            break;
+        case FieldType::NodeList:
+            doc += "\n";
+            for (const auto& element : field.nodes) {
+                doc += indent(level + 1) + "-\n";
+                writeYamlNode(doc, element, level + 2);
+            }
+            break;
+        }
+    }
+}
+
+inline void writeTextParams(std::string& doc, const Node& node, int level)
+{
+    for (const auto& field : node.fields) {
+        if (field.type == FieldType::Param)
+            doc += indent(level) + field.name + " = " + textValue(field.valueType, field.values.front()) + "\n";
+        else if (field.type == FieldType::ParamList)
+            doc += indent(level) + field.name + " = " + textValueList(field) + "\n";
+    }
+}
+
+// TOML tables of nested nodes and node list elements are declared with full paths, where the path of a node list
+// refers to its last declared element
+inline void writeTomlNode(std::string& doc, const Node& node, const std::string& path, int level)
+{
+    writeTextParams(doc, node, level);
+    for (const auto& field : node.fields) {
+        const auto fieldPath = path.empty() ? field.name : path + "." + field.name;
+        switch (field.type) {
+        case FieldType::Param:
+        case FieldType::ParamList:
+            break;
+        case FieldType::Dict:
+            doc += indent(level) + "[" + fieldPath + "]\n";
+            for (auto i = std::size_t{}; i < field.values.size(); ++i)
+                doc += indent(level + 1) + field.keys[i] + " = " + textValue(field.valueType, field.values[i]) +
+                        "\n";
+            break;
+        case FieldType::Node:
+            doc += indent(level) + "[" + fieldPath + "]\n";
+            writeTomlNode(doc, field.nodes.front(), fieldPath, level + 1);
+            break;
+        case FieldType::NodeList:
+            for (const auto& element : field.nodes) {
+                doc += indent(level) + "[[" + fieldPath + "]]\n";
+                writeTomlNode(doc, element, fieldPath, level + 1);
+            }
+            break;
+        }
+    }
+}
+
+// INI sections are declared with full paths, node list elements are addressed by their indices
+inline void writeIniNode(std::string& doc, const Node& node, const std::string& path, int level)
+{
+    writeTextParams(doc, node, level);
+    for (const auto& field : node.fields) {
+        const auto fieldPath = path.empty() ? field.name : path + "." + field.name;
+        switch (field.type) {
+        case FieldType::Param:
+        case FieldType::ParamList:
+            break;
+        case FieldType::Dict:
+            doc += indent(level) + "[" + fieldPath + "]\n";
+            for (auto i = std::size_t{}; i < field.values.size(); ++i)
+                doc += indent(level + 1) + field.keys[i] + " = " + textValue(field.valueType, field.values[i]) +
+                        "\n";
+            break;
+        case FieldType::Node:
+            doc += indent(level) + "[" + fieldPath + "]\n";
+            writeIniNode(doc, field.nodes.front(), fieldPath, level + 1);
+            break;
+        case FieldType::NodeList:
+            for (auto i = std::size_t{}; i < field.nodes.size(); ++i) {
+                const auto elementPath = fieldPath + "." + std::to_string(i);
+                doc += indent(level) + "[" + elementPath + "]\n";
+                writeIniNode(doc, field.nodes[i], elementPath, level + 1);
+            }
+            break;
+        }
+    }
+}
+
+// Parameters are written as XML attributes, nested nodes and node lists as child elements
+inline void writeXmlNode(std::string& doc, const Node& node, const std::string& tagName, int level)
+{
+    doc += indent(level) + "<" + tagName;
+    for (const auto& field : node.fields) {
+        if (field.type == FieldType::Param)
+            doc += " " + field.name + "=\"" + field.values.front() + "\"";
+        else if (field.type == FieldType::ParamList)
+            doc += " " + field.name + "=\"" + xmlValueList(field) + "\"";
+    }
+    auto hasChildren = false;
+    for (const auto& field : node.fields) {
+        if (isParamField(field))
+            continue;
+        if (!hasChildren)
+            doc += ">\n";
+        hasChildren = true;
+        switch (field.type) {
+        case FieldType::Param:
+        case FieldType::ParamList:
+            break;
+        case FieldType::Dict:
+            doc += indent(level + 1) + "<" + field.name;
+            for (auto i = std::size_t{}; i < field.values.size(); ++i)
+                doc += " " + field.keys[i] + "=\"" + field.values[i] + "\"";
+            doc += "/>\n";
+            break;
+        case FieldType::Node:
+            writeXmlNode(doc, field.nodes.front(), field.name, level + 1);
+            break;
+        case FieldType::NodeList:
+            doc += indent(level + 1) + "<" + field.name + ">\n";
+            for (const auto& element : field.nodes)
+                writeXmlNode(doc, element, "item", level + 2);
+            doc += indent(level + 1) + "</" + field.name + ">\n";
+            break;
+        }
+    }
+    if (hasChildren)
+        doc += indent(level) + "</" + tagName + ">\n";
+    else
+        doc += "/>\n";
+}
+
+// Every opened shoal node and node list is closed with the '-' line
+inline void writeShoalNode(std::string& doc, const Node& node, int level)
+{
+    writeTextParams(doc, node, level);
+    for (const auto& field : node.fields) {
+        switch (field.type) {
+        case FieldType::Param:
+        case FieldType::ParamList:
+            break;
+        case FieldType::Dict:
+            doc += indent(level) + "#" + field.name + ":\n";
+            for (auto i = std::size_t{}; i < field.values.size(); ++i)
+                doc += indent(level + 1) + field.keys[i] + " = " + textValue(field.valueType, field.values[i]) +
+                        "\n";
+            doc += indent(level) + "-\n";
+            break;
+        case FieldType::Node:
+            doc += indent(level) + "#" + field.name + ":\n";
+            writeShoalNode(doc, field.nodes.front(), level + 1);
+            doc += indent(level) + "-\n";
+            break;
+        case FieldType::NodeList:
+            doc += indent(level) + "#" + field.name + ":\n";
+            for (const auto& element : field.nodes) {
+                doc += indent(level) + "###\n";
+                writeShoalNode(doc, element, level + 1);
+            }
+            doc += indent(level) + "-\n";
+            break;
+        }
+    }
+}
+
+} //namespace detail
+
+// Writes the document in the specified format. Documents written from the same generated Node in different formats
+// are read into the same config structure.
+inline std::string write(const Node& document, Format format)
+{
+    auto doc = std::string{};
+    switch (format) {
+    case Format::Json:
+        detail::writeJsonNode(doc, document, 0);
+        doc += "\n";
+        break;
+    case Format::Yaml:
+        detail::writeYamlNode(doc, document, 0);
+        break;
+    case Format::Toml:
+        detail::writeTomlNode(doc, document, {}, 0);
+        break;
+    case Format::Ini:
+        detail::writeIniNode(doc, document, {}, 0);
+        break;
+    case Format::Xml:
+        detail::writeXmlNode(doc, document, "root", 0);
+        break;
+    case Format::Shoal:
+        detail::writeShoalNode(doc, document, 0);
+        break;
+    }
+    return doc;
+}
+
+} //namespace figcone::configgen
+
+#endif //FIGCONE_CONFIGGEN_WRITER_H
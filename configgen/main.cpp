@@ -0,0 +1,103 @@
+#include <figcone/commandlineparser.h>
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone/validators.h>
+#include <figcone_configgen/generator.h>
+#include <figcone_configgen/writer.h>
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr auto formatNames = std::array{"all", "json", "yaml", "toml", "ini", "xml", "shoal"};
+constexpr auto valueTypeNames = std::array{"bool", "integer", "real", "string"};
+
+std::optional<figcone::configgen::ValueType> valueTypeFromName(const std::string& name)
+{
+    for (auto i = std::size_t{}; i < valueTypeNames.size(); ++i)
+        if (name == valueTypeNames[i])
+            return static_cast<figcone::configgen::ValueType>(i);
+    return std::nullopt;
+}
+
+struct ConfigGenCfg : public figcone::Config {
+    FIGCONE_PARAM(format, std::string)("all").ensure<figcone::validator::OneOf<formatNames>>();
+    FIGCONE_PARAM(seed, std::uint64_t)(0);
+    FIGCONE_PARAM(depth, int)(2).ensure<figcone::validator::Min<0>>();
+    FIGCONE_PARAM(width, int)(4).ensure<figcone::validator::Min<0>>();
+    FIGCONE_PARAM(nodeCount, int)(1).ensure<figcone::validator::Min<0>>();
+    FIGCONE_PARAM(nodeListLength, int)(2).ensure<figcone::validator::Min<0>>();
+    FIGCONE_PARAM(paramListLength, int)(3).ensure<figcone::validator::Min<0>>();
+    FIGCONE_PARAM(dictSize, int)(2).ensure<figcone::validator::Min<0>>();
+    FIGCONE_PARAMLIST(valueTypes, std::vector<std::string>)
+    (std::vector<std::string>{valueTypeNames.begin(), valueTypeNames.end()})
+            .ensure(
+                    [](const std::vector<std::string>& valueTypes) -> std::optional<std::string>
+                    {
+                        if (valueTypes.empty())
+                            return "list can't be empty";
+                        for (const auto& valueType : valueTypes)
+                            if (!valueTypeFromName(valueType))
+                                return "unknown value type '" + valueType + "'";
+                        return std::nullopt;
+                    });
+    FIGCONE_PARAM(outputDir, std::filesystem::path)(".");
+    FIGCONE_PARAM(name, std::string)("config").ensure<figcone::validator::NotEmpty>();
+};
+
+figcone::configgen::Shape makeShape(const ConfigGenCfg& cfg)
+{
+    auto shape = figcone::configgen::Shape{};
+    shape.depth = cfg.depth;
+    shape.width = cfg.width;
+    shape.nodeCount = cfg.nodeCount;
+    shape.nodeListLength = cfg.nodeListLength;
+    shape.paramListLength = cfg.paramListLength;
+    shape.dictSize = cfg.dictSize;
+    shape.valueTypes.clear();
+    for (const auto& valueType : cfg.valueTypes)
+        shape.valueTypes.emplace_back(*valueTypeFromName(valueType));
+    return shape;
+}
+
+} //namespace
+
+int main(int argc, char** argv)
+{
+    auto commandLineParser = figcone::CommandLineParser<ConfigGenCfg>{argc, argv, figcone::NameFormat::KebabCase};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::KebabCase};
+    auto cfg = cfgReader.tryRead<ConfigGenCfg>("", commandLineParser);
+    if (!cfg) {
+        std::cerr << cfg.error().what() << std::endl;
+        std::cerr << "Usage: figcone_configgen [--format all|json|yaml|toml|ini|xml|shoal] [--seed <number>]\n"
+                     "                         [--depth <number>] [--width <number>] [--node-count <number>]\n"
+                     "                         [--node-list-length <number>] [--param-list-length <number>]\n"
+                     "                         [--dict-size <number>] [--value-types bool|integer|real|string]...\n"
+                     "                         [--output-dir <path>] [--name <file name>]"
+                  << std::endl;
+        return 1;
+    }
+
+    const auto document = figcone::configgen::generate(makeShape(*cfg), cfg->seed);
+    for (auto format : figcone::configgen::allFormats()) {
+        const auto name = figcone::configgen::formatName(format);
+        if (cfg->format != "all" && cfg->format != name)
+            continue;
+
+        const auto path = cfg->outputDir / (cfg->name + "." + name);
+        auto file = std::ofstream{path, std::ios::binary};
+        file << figcone::configgen::write(document, format);
+        if (!file) {
+            std::cerr << "Couldn't write the file " << path << std::endl;
+            return 1;
+        }
+        std::cout << "Generated " << path.string() << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,254 @@
+#ifndef FIGCONE_ALLOCATIONCOUNTING_H
+#define FIGCONE_ALLOCATIONCOUNTING_H
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace figcone {
+
+struct AllocationCount {
+    std::size_t allocations = 0;
+    std::size_t bytes = 0;
+};
+
+inline AllocationCount operator-(const AllocationCount& lhs, const AllocationCount& rhs)
+{
+    return {lhs.allocations - rhs.allocations, lhs.bytes - rhs.bytes};
+}
+
+inline AllocationCount operator+(const AllocationCount& lhs, const AllocationCount& rhs)
+{
+    return {lhs.allocations + rhs.allocations, lhs.bytes + rhs.bytes};
+}
+
+namespace detail {
+inline AllocationCount& threadAllocationCount()
+{
+    thread_local auto count = AllocationCount{};
+    return count;
+}
+} //namespace detail
+
+// Returns the number of allocations made by the current thread through the global operator new.
+// Allocations are counted only when FIGCONE_IMPLEMENT_ALLOCATION_COUNTING is defined in one of the program's
+// translation units before including this header.
+inline AllocationCount threadAllocationCount()
+{
+    return detail::threadAllocationCount();
+}
+
+// Memory resource counting the allocations made through it
+class CountingMemoryResource : public std::pmr::memory_resource {
+public:
+    explicit CountingMemoryResource(std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+        : upstream_{upstream}
+    {
+    }
+
+    AllocationCount count() const
+    {
+        return count_;
+    }
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        ++count_.allocations;
+        count_.bytes += bytes;
+        return upstream_->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override
+    {
+        upstream_->deallocate(ptr, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+private:
+    std::pmr::memory_resource* upstream_;
+    AllocationCount count_;
+};
+
+} //namespace figcone
+
+#endif //FIGCONE_ALLOCATIONCOUNTING_H
+
+// Replaces all replaceable global allocation functions with the ones counting allocations of each thread.
+// Allocation functions are global, so the macro must be defined in a single translation unit of a program.
+#if defined(FIGCONE_IMPLEMENT_ALLOCATION_COUNTING) && !defined(FIGCONE_ALLOCATION_COUNTING_IMPLEMENTED)
+#define FIGCONE_ALLOCATION_COUNTING_IMPLEMENTED
+#include "detail/exceptions.h"
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <new>
+
+namespace figcone::detail {
+// Over-aligned blocks are allocated with malloc too, the pointer to the allocated block is stored before the
+// returned address
+inline void* allocateAligned(std::size_t size, std::size_t alignment) noexcept
+{
+    if (size > std::numeric_limits<std::size_t>::max() - alignment - sizeof(void*))
+        return nullptr;
+    auto block = std::malloc(size + alignment + sizeof(void*));
+    if (!block)
+        return nullptr;
+    const auto address = (reinterpret_cast<std::uintptr_t>(block) + sizeof(void*) + alignment - 1) &
+            ~static_cast<std::uintptr_t>(alignment - 1);
+    auto ptr = reinterpret_cast<void*>(address);
+    static_cast<void**>(ptr)[-1] = block;
+    return ptr;
+}
+
+inline void deallocateAligned(void* ptr) noexcept
+{
+    if (ptr)
+        std::free(static_cast<void**>(ptr)[-1]);
+}
+
+// The new handler can throw std::bad_alloc, like the standard allocation functions do
+inline void* countedAllocate(std::size_t size, std::size_t alignment = 0)
+{
+    if (!size)
+        size = 1;
+    while (true) {
+        auto ptr = alignment ? allocateAligned(size, alignment) : std::malloc(size);
+        if (ptr) {
+            auto& count = threadAllocationCount();
+            ++count.allocations;
+            count.bytes += size;
+            return ptr;
+        }
+        auto newHandler = std::get_new_handler();
+        if (!newHandler)
+            return nullptr;
+        newHandler();
+    }
+}
+
+inline void* countedAllocateOrThrow(std::size_t size, std::size_t alignment = 0)
+{
+    if (auto ptr = countedAllocate(size, alignment))
+        return ptr;
+    throwError(std::bad_alloc{});
+}
+
+inline void* countedAllocateNoThrow(std::size_t size, std::size_t alignment = 0) noexcept
+{
+#if FIGCONE_EXCEPTIONS_ENABLED
+    try {
+        return countedAllocate(size, alignment);
+    }
+    catch (...) {
+        return nullptr;
+    }
+#else
+    return countedAllocate(size, alignment);
+#endif
+}
+} //namespace figcone::detail
+
+void* operator new(std::size_t size)
+{
+    return figcone::detail::countedAllocateOrThrow(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return figcone::detail::countedAllocateOrThrow(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return figcone::detail::countedAllocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return figcone::detail::countedAllocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return figcone::detail::countedAllocateNoThrow(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return figcone::detail::countedAllocateNoThrow(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return figcone::detail::countedAllocateNoThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return figcone::detail::countedAllocateNoThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+    figcone::detail::deallocateAligned(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept
+{
+    figcone::detail::deallocateAligned(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    figcone::detail::deallocateAligned(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    figcone::detail::deallocateAligned(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    figcone::detail::deallocateAligned(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    figcone::detail::deallocateAligned(ptr);
+}
+#endif
@@ -0,0 +1,110 @@
+#ifndef FIGCONE_ALLOCATIONSTATSOBSERVER_H
+#define FIGCONE_ALLOCATIONSTATSOBSERVER_H
+
+#include "allocationcounting.h"
+#include "readobserver.h"
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace figcone {
+
+struct PhaseAllocationStats {
+    ReadPhase phase;
+    // Dot separated path of the config node with indices of node list elements, like testNodes[0].testNode, for the
+    // ReadPhase::Node, ReadPhase::NodeList and ReadPhase::NodeListElement phases,
+    // name of the config layer for the ReadPhase::Parse phase of ConfigReader::readLayers
+    std::string path;
+    // Allocations of the phase including its nested phases
+    AllocationCount total;
+    // Allocations of the phase excluding its nested phases
+    AllocationCount self;
+};
+
+// Read observer that counts allocations of every read phase and config section.
+// By default, allocations are taken from figcone::threadAllocationCount(), which requires defining
+// FIGCONE_IMPLEMENT_ALLOCATION_COUNTING in one of the program's translation units. Any other source of the
+// allocation count, like figcone::CountingMemoryResource, can be passed to the constructor.
+// Allocations made by the observer itself aren't counted.
+class AllocationStatsObserver : public IReadObserver {
+    struct OpenPhase {
+        std::size_t statsIndex;
+        AllocationCount startCount;
+        AllocationCount nestedCount;
+    };
+
+public:
+    explicit AllocationStatsObserver(std::function<AllocationCount()> allocationCount = threadAllocationCount)
+        : allocationCount_{std::move(allocationCount)}
+    {
+    }
+
+    void onPhaseBegin(const ReadPhaseInfo& phaseInfo) override
+    {
+        const auto callbackStartCount = allocationCount_();
+        auto path = std::string{phaseInfo.name};
+        if (phaseInfo.phase == ReadPhase::NodeListElement)
+            path = "[" + path + "]";
+        if (isConfigSectionPhase(phaseInfo.phase))
+            for (auto it = openPhases_.rbegin(); it != openPhases_.rend(); ++it) {
+                const auto& parentStats = stats_[it->statsIndex];
+                if (isConfigSectionPhase(parentStats.phase)) {
+                    const auto separator = phaseInfo.phase == ReadPhase::NodeListElement ? "" : ".";
+                    path = parentStats.path + separator + path;
+                    break;
+                }
+            }
+        stats_.push_back({phaseInfo.phase, std::move(path), {}, {}});
+        openPhases_.push_back({stats_.size() - 1, {}, {}});
+        observerCount_ = observerCount_ + (allocationCount_() - callbackStartCount);
+        openPhases_.back().startCount = observedCount();
+    }
+
+    void onPhaseEnd(const ReadPhaseInfo&) override
+    {
+        if (openPhases_.empty())
+            return;
+        const auto phase = openPhases_.back();
+        openPhases_.pop_back();
+        auto& phaseStats = stats_[phase.statsIndex];
+        phaseStats.total = observedCount() - phase.startCount;
+        phaseStats.self = phaseStats.total - phase.nestedCount;
+        if (!openPhases_.empty())
+            openPhases_.back().nestedCount = openPhases_.back().nestedCount + phaseStats.total;
+    }
+
+    // Returns statistics of the finished phases in the order of their beginning
+    const std::vector<PhaseAllocationStats>& stats() const
+    {
+        return stats_;
+    }
+
+    void clear()
+    {
+        stats_.clear();
+        openPhases_.clear();
+    }
+
+private:
+    static bool isConfigSectionPhase(ReadPhase phase)
+    {
+        return phase == ReadPhase::Node || phase == ReadPhase::NodeList || phase == ReadPhase::NodeListElement;
+    }
+
+    AllocationCount observedCount() const
+    {
+        return allocationCount_() - observerCount_;
+    }
+
+private:
+    std::function<AllocationCount()> allocationCount_;
+    std::vector<PhaseAllocationStats> stats_;
+    std::vector<OpenPhase> openPhases_;
+    AllocationCount observerCount_;
+};
+
+} //namespace figcone
+
+#endif //FIGCONE_ALLOCATIONSTATSOBSERVER_H
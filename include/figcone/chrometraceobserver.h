@@ -0,0 +1,111 @@
+#ifndef FIGCONE_CHROMETRACEOBSERVER_H
+#define FIGCONE_CHROMETRACEOBSERVER_H
+
+#include "readobserver.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace figcone {
+
+// Read observer that records the read phases as events of the Chrome trace event format.
+// The written trace can be opened in Perfetto or in the chrome://tracing page. Event timestamps are written in whole
+// microseconds from the creation of the observer or from the last clear() call.
+template<typename TClock = std::chrono::steady_clock>
+class BasicChromeTraceObserver : public IReadObserver {
+    struct Event {
+        char type;
+        ReadPhase phase;
+        std::string name;
+        std::size_t byteCount;
+        std::size_t elementCount;
+        typename TClock::duration time;
+    };
+
+public:
+    void onPhaseBegin(const ReadPhaseInfo& phaseInfo) override
+    {
+        addEvent('B', phaseInfo);
+    }
+
+    void onPhaseEnd(const ReadPhaseInfo& phaseInfo) override
+    {
+        addEvent('E', phaseInfo);
+    }
+
+    void write(std::ostream& stream) const
+    {
+        stream << "{\"traceEvents\":[";
+        for (auto i = std::size_t{0}; i < events_.size(); ++i) {
+            const auto& event = events_[i];
+            const auto timestamp = std::chrono::duration_cast<std::chrono::microseconds>(event.time).count();
+            stream << (i ? ",\n" : "\n") << R"({"name":")" << escape(event.name) << R"(","cat":")"
+                   << readPhaseName(event.phase) << R"(","ph":")" << event.type << R"(","ts":)" << timestamp
+                   << R"(,"pid":1,"tid":1)";
+            if (event.type == 'B')
+                stream << R"(,"args":{"bytes":)" << event.byteCount << R"(,"elements":)" << event.elementCount
+                       << "}";
+            stream << "}";
+        }
+        stream << "\n]}\n";
+    }
+
+    std::string trace() const
+    {
+        auto stream = std::stringstream{};
+        write(stream);
+        return stream.str();
+    }
+
+    void clear()
+    {
+        events_.clear();
+        startTime_ = TClock::now();
+    }
+
+private:
+    void addEvent(char type, const ReadPhaseInfo& phaseInfo)
+    {
+        events_.push_back(
+                {type,
+                 phaseInfo.phase,
+                 std::string{phaseInfo.name.empty() ? readPhaseName(phaseInfo.phase) : phaseInfo.name},
+                 phaseInfo.byteCount,
+                 phaseInfo.elementCount,
+                 TClock::now() - startTime_});
+    }
+
+    static std::string escape(std::string_view str)
+    {
+        auto result = std::string{};
+        for (auto ch : str) {
+            if (ch == '"' || ch == '\\') {
+                result += '\\';
+                result += ch;
+            }
+            else if (static_cast<unsigned char>(ch) < 0x20) {
+                char code[8];
+                std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned>(ch));
+                result += code;
+            }
+            else
+                result += ch;
+        }
+        return result;
+    }
+
+private:
+    std::vector<Event> events_;
+    typename TClock::time_point startTime_ = TClock::now();
+};
+
+using ChromeTraceObserver = BasicChromeTraceObserver<>;
+
+} //namespace figcone
+
+#endif //FIGCONE_CHROMETRACEOBSERVER_H
@@ -0,0 +1,38 @@
+#ifndef FIGCONE_COMMANDLINEPARSER_H
+#define FIGCONE_COMMANDLINEPARSER_H
+
+#include "nameformat.h"
+#include "detail/commandlinemapping.h"
+#include <figcone_tree/iparser.h>
+#include <figcone_tree/tree.h>
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace figcone {
+
+// Reads config parameters of TCfg from the command line flags, e.g. the parameter 'poolSize' of the node 'db' is
+// read from the flag --db.pool-size=32 or --db.pool-size 32 when the kebab case name format is used.
+// Repeated flags of a parameter list add the values to the list.
+template<typename TCfg>
+class CommandLineParser : public IParser {
+public:
+    CommandLineParser(int argc, const char* const* argv, NameFormat nameFormat = NameFormat::Original)
+        : args_(argc > 1 ? argv + 1 : argv, argc > 1 ? argv + argc : argv)
+        , nameFormat_{nameFormat}
+    {
+    }
+
+    Tree parse(std::istream&) override
+    {
+        return detail::readCommandLine(detail::commandLineMapping<TCfg>(nameFormat_), args_);
+    }
+
+private:
+    std::vector<std::string> args_;
+    NameFormat nameFormat_;
+};
+
+} //namespace figcone
+
+#endif //FIGCONE_COMMANDLINEPARSER_H
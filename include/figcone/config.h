@@ -1,10 +1,11 @@
 #ifndef FIGCONE_CONFIG_H
 #define FIGCONE_CONFIG_H
 
-#include "configreader.h"
+#include "configreadercore.h"
 #include "detail/configmacros.h"
 #include "detail/dict.h"
 #include "detail/dictcreator.h"
+#include "detail/fieldlist.h"
 #include "detail/initializedoptional.h"
 #include "detail/inode.h"
 #include "detail/ivalidator.h"
@@ -22,6 +23,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace figcone {
@@ -130,11 +132,16 @@ protected:
         return cfgReader_;
     }
 
+    // Start of the compile time field list extended by the FIGCONE_* macros
+    static std::integral_constant<int, 0> figconeFieldCount(detail::FieldRank<0>);
+    friend detail::FieldList<> figconeFields(detail::FieldRank<0>, const Config&);
+
 private:
     template<auto member, typename T, typename TCfg>
     auto node(T TCfg::*, const std::string& memberName)
     {
         auto cfg = static_cast<TCfg*>(this);
+        registerField(memberName);
         return detail::NodeCreator<T>{cfgReader(), memberName, cfg->*member};
     }
 
@@ -142,6 +149,7 @@ private:
     auto dict(TMap TCfg::*, const std::string& memberName)
     {
         auto cfg = static_cast<TCfg*>(this);
+        registerField(memberName);
         return detail::DictCreator<TMap>{cfgReader(), memberName, cfg->*member};
     }
 
@@ -149,6 +157,7 @@ private:
     auto nodeList(TCfgList TCfg::*, const std::string& memberName)
     {
         auto cfg = static_cast<TCfg*>(this);
+        registerField(memberName);
         return detail::NodeListCreator<TCfgList>{cfgReader(), memberName, cfg->*member};
     }
 
@@ -156,6 +165,7 @@ private:
     auto copyNodeList(TCfgList TCfg::*, const std::string& memberName)
     {
         auto cfg = static_cast<TCfg*>(this);
+        registerField(memberName, true);
         return detail::NodeListCreator<TCfgList>{cfgReader(), memberName, cfg->*member, detail::NodeListType::Copy};
     }
 
@@ -163,6 +173,7 @@ private:
     auto param(T TCfg::*, const std::string& memberName)
     {
         auto cfg = static_cast<TCfg*>(this);
+        registerField(memberName);
         return detail::ParamCreator<T>{cfgReader(), memberName, cfg->*member};
     }
 
@@ -170,9 +181,16 @@ private:
     auto paramList(T TCfg::*, const std::string& memberName)
     {
         auto cfg = static_cast<TCfg*>(this);
+        registerField(memberName);
         return detail::ParamListCreator<T>{cfgReader(), memberName, cfg->*member};
     }
 
+    void registerField(const std::string& memberName, bool isCopyNodeList = false)
+    {
+        if (cfgReader_)
+            detail::ConfigReaderAccess{cfgReader_}.addRegisteredField(memberName, isCopyNodeList);
+    }
+
 private:
     detail::ConfigReaderPtr cfgReader_;
     friend class ConfigReader;
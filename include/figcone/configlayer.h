@@ -0,0 +1,78 @@
+#ifndef FIGCONE_CONFIGLAYER_H
+#define FIGCONE_CONFIGLAYER_H
+
+#include "errors.h"
+#include "expected.h"
+#include "detail/configfile.h"
+#include "detail/parse.h"
+#include "detail/external/eel/path.h"
+#include <figcone_tree/iparser.h>
+#include <figcone_tree/tree.h>
+#include <filesystem>
+#include <sstream>
+#include <string>
+#include <variant>
+
+namespace figcone {
+
+class ConfigLayer {
+public:
+    static ConfigLayer fromFile(const std::filesystem::path& configFile, IParser& parser)
+    {
+        return ConfigLayer{eel::to_string(configFile), configFile, parser};
+    }
+
+    static ConfigLayer fromString(std::string configContent, IParser& parser, std::string name = "string")
+    {
+        return ConfigLayer{std::move(name), std::move(configContent), parser};
+    }
+
+    static ConfigLayer fromParser(IParser& parser, std::string name)
+    {
+        return ConfigLayer{std::move(name), std::string{}, parser};
+    }
+
+    const std::string& name() const
+    {
+        return name_;
+    }
+
+    Tree parse() const
+    {
+        if (auto configFile = std::get_if<std::filesystem::path>(&source_)) {
+            auto configStream = detail::openConfigFile(*configFile).value();
+            return parser_->parse(configStream);
+        }
+        auto configStream = std::stringstream{std::get<std::string>(source_)};
+        return parser_->parse(configStream);
+    }
+
+    Expected<Tree, ConfigError> tryParse() const
+    {
+        if (auto configFile = std::get_if<std::filesystem::path>(&source_)) {
+            auto configStream = detail::openConfigFile(*configFile);
+            if (!configStream)
+                return Unexpected{std::move(configStream).error()};
+            return detail::tryParse(*parser_, *configStream);
+        }
+        auto configStream = std::stringstream{std::get<std::string>(source_)};
+        return detail::tryParse(*parser_, configStream);
+    }
+
+private:
+    ConfigLayer(std::string name, std::variant<std::filesystem::path, std::string> source, IParser& parser)
+        : name_{std::move(name)}
+        , source_{std::move(source)}
+        , parser_{&parser}
+    {
+    }
+
+private:
+    std::string name_;
+    std::variant<std::filesystem::path, std::string> source_;
+    IParser* parser_;
+};
+
+} //namespace figcone
+
+#endif //FIGCONE_CONFIGLAYER_H
@@ -0,0 +1,1011 @@
+#ifndef FIGCONE_CONFIGREADERCORE_H
+#define FIGCONE_CONFIGREADERCORE_H
+
+#include "configlayer.h"
+#include "errorreporting.h"
+#include "errors.h"
+#include "expected.h"
+#include "nameformat.h"
+#include "postprocessor.h"
+#include "readobserver.h"
+#include "unregisteredfieldhandler.h"
+#include "validationexecutor.h"
+#include "detail/configfile.h"
+#include "detail/configreaderptr.h"
+#include "detail/creatormode.h"
+#include "detail/deferredvalidator.h"
+#include "detail/dictcreator.h"
+#include "detail/exceptions.h"
+#include "detail/external/eel/path.h"
+#include "detail/external/eel/type_traits.h"
+#include "detail/external/pfr.hpp"
+#include "detail/fieldtraits.h"
+#include "detail/formatparser.h"
+#include "detail/inode.h"
+#include "detail/iparam.h"
+#include "detail/ivalidator.h"
+#include "detail/memoryresource.h"
+#include "detail/nameutils.h"
+#include "detail/nodecreator.h"
+#include "detail/nodelistcreator.h"
+#include "detail/paramcreator.h"
+#include "detail/paramlistcreator.h"
+#include "detail/parse.h"
+#include "detail/readobservation.h"
+#include "detail/registeredfield.h"
+#include "detail/schema.h"
+#include "detail/stringconverter.h"
+#include "detail/treemerge.h"
+#include "detail/unregisteredfieldutils.h"
+#include "detail/utils.h"
+#include <figcone_tree/iparser.h>
+#include <figcone_tree/stringconverter.h>
+#include <figcone_tree/tree.h>
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace figcone {
+
+namespace detail {
+template<typename TConfigReaderPtr>
+class ConfigReaderAccess;
+}
+
+class Config;
+
+enum class RootType {
+    SingleNode,
+    NodeList
+};
+
+class ConfigReader {
+
+public:
+    explicit ConfigReader(
+            NameFormat nameFormat = NameFormat::Original,
+            ErrorReporting errorReporting = ErrorReporting::FirstError)
+        : nameFormat_{nameFormat}
+        , errorReporting_{errorReporting}
+    {
+    }
+
+    // The observer receives events of the read phases of all following reads, nullptr detaches it
+    void setReadObserver(IReadObserver* readObserver)
+    {
+        readObserver_ = readObserver;
+    }
+
+    // Strings, containers and maps of the following read configs use the memory resource if their types support
+    // polymorphic allocators, like std::pmr::string and std::pmr::vector. nullptr restores the default allocation.
+    void setMemoryResource(std::pmr::memory_resource* memoryResource)
+    {
+        memoryResource_ = memoryResource;
+    }
+
+    // Validators of the following reads are collected from the whole config and run by the executor after it's loaded,
+    // e.g. by figcone::ValidationThreadPool. nullptr restores running the validators when each config node is loaded.
+    void setValidationExecutor(IValidationExecutor* validationExecutor)
+    {
+        validationExecutor_ = validationExecutor;
+    }
+
+    template<typename TCfg, RootType rootType = RootType::SingleNode>
+    auto readFile(const std::filesystem::path& configFile, IParser& parser)
+            -> std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>
+    {
+        auto configStream = detail::openConfigFile(configFile).value();
+        if (readObserver_) {
+            auto fileContentStream = readFileContent(configStream);
+            return read<TCfg, rootType>(fileContentStream, parser);
+        }
+        return read<TCfg, rootType>(configStream, parser);
+    }
+
+    template<typename TCfg, RootType rootType = RootType::SingleNode>
+    auto read(const std::string& configContent, IParser& parser)
+            -> std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>
+    {
+        auto configStream = std::stringstream{configContent};
+        return read<TCfg, rootType>(configStream, parser);
+    }
+
+    // Reads the config from the tree created by a parser. The tree is consumed: string values are moved to the config
+    // fields instead of being copied.
+    template<typename TCfg, RootType rootType = RootType::SingleNode>
+    auto read(Tree&& tree) -> std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>
+    {
+        return valueOrThrow(readTree<TCfg, rootType>(std::move(tree)));
+    }
+
+    template<typename TCfg>
+    TCfg readLayers(const std::vector<ConfigLayer>& layers)
+    {
+        auto layerTrees = std::vector<Tree>{};
+        layerTrees.reserve(layers.size());
+        for (const auto& layer : layers) {
+            auto observedPhase = detail::ObservedReadPhase{readObserver_, ReadPhase::Parse, layer.name()};
+            layerTrees.emplace_back(layer.parse());
+        }
+        return valueOrThrow(readLayerTrees<TCfg>(layers, layerTrees));
+    }
+
+    template<typename TCfg, RootType rootType = RootType::SingleNode>
+    auto tryReadFile(const std::filesystem::path& configFile, IParser& parser)
+            -> Expected<std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>, ConfigErrorList>
+    {
+        auto configStream = detail::openConfigFile(configFile);
+        if (!configStream)
+            return Unexpected{makeErrorList(configStream.error())};
+        if (readObserver_) {
+            auto fileContentStream = readFileContent(*configStream);
+            return tryRead<TCfg, rootType>(fileContentStream, parser);
+        }
+        return tryRead<TCfg, rootType>(*configStream, parser);
+    }
+
+    template<typename TCfg, RootType rootType = RootType::SingleNode>
+    auto tryRead(const std::string& configContent, IParser& parser)
+            -> Expected<std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>, ConfigErrorList>
+    {
+        auto configStream = std::stringstream{configContent};
+        return tryRead<TCfg, rootType>(configStream, parser);
+    }
+
+    template<typename TCfg, RootType rootType = RootType::SingleNode>
+    auto tryRead(Tree&& tree)
+            -> Expected<std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>, ConfigErrorList>
+    {
+        return readTree<TCfg, rootType>(std::move(tree));
+    }
+
+    template<typename TCfg>
+    Expected<TCfg, ConfigErrorList> tryReadLayers(const std::vector<ConfigLayer>& layers)
+    {
+        auto layerTrees = std::vector<Tree>{};
+        layerTrees.reserve(layers.size());
+        for (const auto& layer : layers) {
+            auto observedPhase = detail::ObservedReadPhase{readObserver_, ReadPhase::Parse, layer.name()};
+            auto layerTree = layer.tryParse();
+            if (!layerTree)
+                return Unexpected{makeErrorList(layerTree.error())};
+            layerTrees.emplace_back(std::move(*layerTree));
+        }
+        return readLayerTrees<TCfg>(layers, layerTrees);
+    }
+
+    template<typename TCfg, RootType rootType = RootType::SingleNode>
+    auto readJsonFile(const std::filesystem::path& configFile)
+            -> std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>
+    {
+        auto parser = detail::makeFormatParser<detail::JsonFormat, TCfg>();
+        return readFile<TCfg, rootType>(configFile, parser);
+    }
+
+    template<typename TCfg, RootType rootType = RootType::SingleNode>
+    auto readJson(const std::string& configContent)
+            -> std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>
+    {
+        auto parser = detail::makeFormatParser<detail::JsonFormat, TCfg>();
+        return read<TCfg, rootType>(configContent, parser);
+    }
+
+    template<typename TCfg, RootType rootType = RootType::SingleNode>
+    auto readJson(std::istream& configStream)
+            -> std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>
+    {
+        auto parser = detail::makeFormatParser<detail::JsonFormat, TCfg>();
+        return read<TCfg, rootType>(configStream, parser);
+    }
+
+    template<typename TCfg, RootType rootType = RootType::SingleNode>
+    auto tryReadJsonFile(const std::filesystem::path& configFile)
+            -> Expected<std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>, ConfigErrorList>
+    {
+        auto parser = detail::makeFormatParser<detail::JsonFormat, TCfg>();
+        return tryReadFile<TCfg, rootType>(configFile, parser);
+    }
+
+    template<typename TCfg, RootType rootType = RootType::SingleNode>
+    auto tryReadJson(const std::string& configContent)
+            -> Expected<std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>, ConfigErrorList>
+    {
+        auto parser = detail::makeFormatParser<detail::JsonFormat, TCfg>();
+        return tryRead<TCfg, rootType>(configContent, parser);
+    }
+
+    template<typename TCfg, RootType rootType = RootType::SingleNode>
+    auto tryReadJson(std::istream& configStream)
+            -> Expected<std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>, ConfigErrorList>
+    {
+        auto parser = detail::makeFormatParser<detail::JsonFormat, TCfg>();
+        return tryRead<TCfg, rootType>(configStream, parser);
+    }
+
+    template<typename TCfg, RootType rootType = RootType::SingleNode>
+    auto readYamlFile(const std::filesystem::path& configFile)
+            -> std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>
+    {
+        auto parser = detail::makeFormatParser<detail::YamlFormat, TCfg>();
+        return readFile<TCfg, rootType>(configFile, parser);
+    }
+
+    template<typename TCfg, RootType rootType = RootType::SingleNode>
+    auto readYaml(const std::string& configContent)
+            -> std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>
+    {
+        auto parser = detail::makeFormatParser<detail::YamlFormat, TCfg>();
+        return read<TCfg, rootType>(configContent, parser);
+    }
+
+    template<typename TCfg, RootType rootType = RootType::SingleNode>
+    auto readYaml(std::istream& configStream)
+            -> std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>
+    {
+        auto parser = detail::makeFormatParser<detail::YamlFormat, TCfg>();
+        return read<TCfg, rootType>(configStream, parser);
+    }
+
+    template<typename TCfg, RootType rootType = RootType::SingleNode>
+    auto tryReadYamlFile(const std::filesystem::path& configFile)
+            -> Expected<std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>, ConfigErrorList>
+    {
+        auto parser = detail::makeFormatParser<detail::YamlFormat, TCfg>();
+        return tryReadFile<TCfg, rootType>(configFile, parser);
+    }
+
+    template<typename TCfg, RootType rootType = RootType::SingleNode>
+    auto tryReadYaml(const std::string& configContent)
+            -> Expected<std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>, ConfigErrorList>
+    {
+        auto parser = detail::makeFormatParser<detail::YamlFormat, TCfg>();
+        return tryRead<TCfg, rootType>(configContent, parser);
+    }
+
+    template<typename TCfg, RootType rootType = RootType::SingleNode>
+    auto tryReadYaml(std::istream& configStream)
+            -> Expected<std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>, ConfigErrorList>
+    {
+        auto parser = detail::makeFormatParser<detail::YamlFormat, TCfg>();
+        return tryRead<TCfg, rootType>(configStream, parser);
+    }
+
+    template<typename TCfg>
+    TCfg readTomlFile(const std::filesystem::path& configFile)
+    {
+        auto parser = detail::makeFormatParser<detail::TomlFormat, TCfg>();
+        return readFile<TCfg>(configFile, parser);
+    }
+    template<typename TCfg>
+    TCfg readToml(const std::string& configContent)
+    {
+        auto configStream = std::stringstream{configContent};
+        return readToml<TCfg>(configStream);
+    }
+    template<typename TCfg>
+    TCfg readToml(std::istream& configStream)
+    {
+        auto parser = detail::makeFormatParser<detail::TomlFormat, TCfg>();
+        return read<TCfg>(configStream, parser);
+    }
+    template<typename TCfg>
+    Expected<TCfg, ConfigErrorList> tryReadTomlFile(const std::filesystem::path& configFile)
+    {
+        auto parser = detail::makeFormatParser<detail::TomlFormat, TCfg>();
+        return tryReadFile<TCfg>(configFile, parser);
+    }
+    template<typename TCfg>
+    Expected<TCfg, ConfigErrorList> tryReadToml(const std::string& configContent)
+    {
+        auto configStream = std::stringstream{configContent};
+        return tryReadToml<TCfg>(configStream);
+    }
+    template<typename TCfg>
+    Expected<TCfg, ConfigErrorList> tryReadToml(std::istream& configStream)
+    {
+        auto parser = detail::makeFormatParser<detail::TomlFormat, TCfg>();
+        return tryRead<TCfg>(configStream, parser);
+    }
+
+    template<typename TCfg>
+    TCfg readIniFile(const std::filesystem::path& configFile)
+    {
+        auto parser = detail::makeFormatParser<detail::IniFormat, TCfg>();
+        return readFile<TCfg>(configFile, parser);
+    }
+    template<typename TCfg>
+    TCfg readIni(const std::string& configContent)
+    {
+        auto configStream = std::stringstream{configContent};
+        return readIni<TCfg>(configStream);
+    }
+    template<typename TCfg>
+    TCfg readIni(std::istream& configStream)
+    {
+        auto parser = detail::makeFormatParser<detail::IniFormat, TCfg>();
+        return read<TCfg>(configStream, parser);
+    }
+    template<typename TCfg>
+    Expected<TCfg, ConfigErrorList> tryReadIniFile(const std::filesystem::path& configFile)
+    {
+        auto parser = detail::makeFormatParser<detail::IniFormat, TCfg>();
+        return tryReadFile<TCfg>(configFile, parser);
+    }
+    template<typename TCfg>
+    Expected<TCfg, ConfigErrorList> tryReadIni(const std::string& configContent)
+    {
+        auto configStream = std::stringstream{configContent};
+        return tryReadIni<TCfg>(configStream);
+    }
+    template<typename TCfg>
+    Expected<TCfg, ConfigErrorList> tryReadIni(std::istream& configStream)
+    {
+        auto parser = detail::makeFormatParser<detail::IniFormat, TCfg>();
+        return tryRead<TCfg>(configStream, parser);
+    }
+
+    template<typename TCfg>
+    TCfg readXmlFile(const std::filesystem::path& configFile)
+    {
+        auto parser = detail::makeFormatParser<detail::XmlFormat, TCfg>();
+        return readFile<TCfg>(configFile, parser);
+    }
+    template<typename TCfg>
+    TCfg readXml(const std::string& configContent)
+    {
+        auto configStream = std::stringstream{configContent};
+        return readXml<TCfg>(configStream);
+    }
+    template<typename TCfg>
+    TCfg readXml(std::istream& configStream)
+    {
+        auto parser = detail::makeFormatParser<detail::XmlFormat, TCfg>();
+        return read<TCfg>(configStream, parser);
+    }
+    template<typename TCfg>
+    Expected<TCfg, ConfigErrorList> tryReadXmlFile(const std::filesystem::path& configFile)
+    {
+        auto parser = detail::makeFormatParser<detail::XmlFormat, TCfg>();
+        return tryReadFile<TCfg>(configFile, parser);
+    }
+    template<typename TCfg>
+    Expected<TCfg, ConfigErrorList> tryReadXml(const std::string& configContent)
+    {
+        auto configStream = std::stringstream{configContent};
+        return tryReadXml<TCfg>(configStream);
+    }
+    template<typename TCfg>
+    Expected<TCfg, ConfigErrorList> tryReadXml(std::istream& configStream)
+    {
+        auto parser = detail::makeFormatParser<detail::XmlFormat, TCfg>();
+        return tryRead<TCfg>(configStream, parser);
+    }
+
+    template<typename TCfg>
+    TCfg readShoalFile(const std::filesystem::path& configFile)
+    {
+        auto parser = detail::makeFormatParser<detail::ShoalFormat, TCfg>();
+        return readFile<TCfg>(configFile, parser);
+    }
+    template<typename TCfg>
+    TCfg readShoal(const std::string& configContent)
+    {
+        auto configStream = std::stringstream{configContent};
+        return readShoal<TCfg>(configStream);
+    }
+    template<typename TCfg>
+    TCfg readShoal(std::istream& configStream)
+    {
+        auto parser = detail::makeFormatParser<detail::ShoalFormat, TCfg>();
+        return read<TCfg>(configStream, parser);
+    }
+    template<typename TCfg>
+    Expected<TCfg, ConfigErrorList> tryReadShoalFile(const std::filesystem::path& configFile)
+    {
+        auto parser = detail::makeFormatParser<detail::ShoalFormat, TCfg>();
+        return tryReadFile<TCfg>(configFile, parser);
+    }
+    template<typename TCfg>
+    Expected<TCfg, ConfigErrorList> tryReadShoal(const std::string& configContent)
+    {
+        auto configStream = std::stringstream{configContent};
+        return tryReadShoal<TCfg>(configStream);
+    }
+    template<typename TCfg>
+    Expected<TCfg, ConfigErrorList> tryReadShoal(std::istream& configStream)
+    {
+        auto parser = detail::makeFormatParser<detail::ShoalFormat, TCfg>();
+        return tryRead<TCfg>(configStream, parser);
+    }
+
+private:
+    void addNode(const std::string& name, std::unique_ptr<detail::INode> node)
+    {
+        nodes_.emplace(detail::convertName(nameFormat_, name), std::move(node));
+    }
+
+    void addParam(const std::string& name, std::unique_ptr<detail::IParam> param)
+    {
+        params_.emplace(detail::convertName(nameFormat_, name), std::move(param));
+    }
+
+    void addValidator(std::unique_ptr<detail::IValidator> validator)
+    {
+        validators_.emplace_back((std::move(validator)));
+    }
+
+    void addRegisteredField(const std::string& name, bool isCopyNodeList)
+    {
+        if (registeredFields_)
+            registeredFields_->push_back({name, isCopyNodeList});
+    }
+
+    template<typename TCfg>
+    std::vector<detail::RegisteredField> collectRegisteredFields()
+    {
+        auto fields = std::vector<detail::RegisteredField>{};
+        registeredFields_ = &fields;
+        [[maybe_unused]] auto cfg = TCfg{makePtr()};
+        registeredFields_ = nullptr;
+        clear();
+        return fields;
+    }
+
+    template<typename TConfig>
+    void load(const TreeNode& treeNode, const std::string& errorMsgPrefix)
+    {
+        for (const auto& nodeName : treeNode.asItem().nodeNames()) {
+            if (isLoadingStopped())
+                return;
+            const auto& node = treeNode.asItem().node(nodeName);
+            auto error = std::optional<ConfigError>{};
+            if (nodes_.count(nodeName)) {
+                auto& configNode = *nodes_.at(nodeName);
+                addEntityLayers(configNode, node);
+                error = configNode.load(node, canMoveTreeValues_);
+            }
+            else
+                error = detail::handleUnregisteredField<TConfig>(FieldType::Node, nodeName, node.position());
+            if (error)
+                reportError(withLayers(node, *error), node.position());
+        }
+
+        for (const auto& paramName : treeNode.asItem().paramNames()) {
+            if (isLoadingStopped())
+                return;
+            const auto& param = treeNode.asItem().param(paramName);
+            auto error = std::optional<ConfigError>{};
+            if (params_.count(paramName)) {
+                auto& configParam = *params_.at(paramName);
+                addEntityLayers(configParam, param);
+                error = configParam.load(param, canMoveTreeValues_);
+            }
+            else
+                error = detail::handleUnregisteredField<TConfig>(FieldType::Param, paramName, param.position());
+            if (error)
+                reportError(withLayers(param, *error), param.position());
+        }
+
+        checkLoadingResult(treeNode, errorMsgPrefix);
+    }
+
+    void checkLoadingResult(const TreeNode& treeNode, const std::string& errorMsgPrefix)
+    {
+        if (isLoadingStopped())
+            return;
+
+        auto missingFieldErrors = std::vector<std::string>{};
+        for (const auto& [name, param] : params_)
+            if (!param->hasValue())
+                missingFieldErrors.emplace_back("Parameter '" + name + "' is missing.");
+        for (const auto& [name, node] : nodes_)
+            if (!node->hasValue())
+                missingFieldErrors.emplace_back("Node '" + name + "' is missing.");
+
+        const auto reportMissingField = [&](const std::string& errorMsg)
+        {
+            reportError(
+                    withLayers(treeNode, ConfigError{errorMsgPrefix + errorMsg, treeNode.position()}),
+                    treeNode.position());
+        };
+        if (!missingFieldErrors.empty() && errorReporting_ == ErrorReporting::FirstError) {
+            reportMissingField(missingFieldErrors.front());
+            return;
+        }
+
+        {
+            // deferred validators are reported in a single validation phase after loading
+            const auto isValidationObserved = readObserver_ && !validators_.empty() && !deferredValidators_;
+            auto observedPhase = detail::ObservedReadPhase{
+                    isValidationObserved ? readObserver_ : nullptr,
+                    ReadPhase::Validation,
+                    {},
+                    0,
+                    validators_.size()};
+            for (const auto& validator : validators_)
+                validate(*validator);
+        }
+
+        for (const auto& errorMsg : missingFieldErrors)
+            reportMissingField(errorMsg);
+    }
+
+    void validate(detail::IValidator& validator)
+    {
+        if (deferredValidators_) {
+            deferredValidators_->push_back({&validator, errorCollector_->size(), entityLayers(validator.entity())});
+            return;
+        }
+        if (auto error = validator.validate())
+            reportError(withLayers(validator.entity(), *error), validator.position());
+    }
+
+    // In the layered mode, errors are prefixed with the names of the layers that have supplied the invalid values
+    template<typename TTreeElement>
+    void addEntityLayers(const detail::IConfigEntity& entity, const TTreeElement& treeElement)
+    {
+        if (!treeOrigins_)
+            return;
+        if (auto layers = treeOrigins_->errorPrefix(treeElement); !layers.empty())
+            entityLayers_.insert_or_assign(&entity, std::move(layers));
+    }
+
+    std::string entityLayers(const detail::IConfigEntity& entity) const
+    {
+        auto it = entityLayers_.find(&entity);
+        if (it == entityLayers_.end())
+            return {};
+        return it->second;
+    }
+
+    template<typename TErrorSource>
+    ConfigError withLayers(const TErrorSource& errorSource, const ConfigError& error) const
+    {
+        auto layers = std::string{};
+        if constexpr (std::is_base_of_v<detail::IConfigEntity, TErrorSource>)
+            layers = entityLayers(errorSource);
+        else if (treeOrigins_)
+            layers = treeOrigins_->errorPrefix(errorSource);
+        if (layers.empty())
+            return error;
+        return ConfigError{layers + error.what()};
+    }
+
+    // With a validation executor, validators are run after the whole config is loaded. Their errors are merged with the
+    // loading errors in the same order as they would be reported without it. If validators throw exceptions other than
+    // figcone::ValidationError, the first one in the order of validators is rethrown.
+    void runDeferredValidators(const std::vector<detail::DeferredValidator>& deferredValidators)
+    {
+        if (deferredValidators.empty())
+            return;
+
+        auto observedPhase =
+                detail::ObservedReadPhase{readObserver_, ReadPhase::Validation, {}, 0, deferredValidators.size()};
+        auto results = std::vector<std::optional<ConfigError>>(deferredValidators.size());
+#if FIGCONE_EXCEPTIONS_ENABLED
+        auto exceptions = std::vector<std::exception_ptr>(deferredValidators.size());
+#endif
+        validationExecutor_->run(
+                deferredValidators.size(),
+                [&](std::size_t index)
+                {
+#if FIGCONE_EXCEPTIONS_ENABLED
+                    try {
+                        results[index] = deferredValidators[index].validator->validate();
+                    }
+                    catch (...) {
+                        exceptions[index] = std::current_exception();
+                    }
+#else
+                    results[index] = deferredValidators[index].validator->validate();
+#endif
+                });
+#if FIGCONE_EXCEPTIONS_ENABLED
+        for (const auto& exception : exceptions)
+            if (exception)
+                std::rethrow_exception(exception);
+#endif
+
+        auto errors = std::vector<ConfigErrorInfo>{};
+        auto loadingErrorIndex = std::size_t{0};
+        for (auto i = std::size_t{0}; i < deferredValidators.size(); ++i) {
+            for (; loadingErrorIndex < deferredValidators[i].errorIndex; ++loadingErrorIndex)
+                errors.push_back(std::move(errorCollector_->at(loadingErrorIndex)));
+            if (results[i])
+                errors.push_back(
+                        {deferredValidators[i].layers + results[i]->what(),
+                         deferredValidators[i].validator->position()});
+        }
+        for (; loadingErrorIndex < errorCollector_->size(); ++loadingErrorIndex)
+            errors.push_back(std::move(errorCollector_->at(loadingErrorIndex)));
+
+        if (errorReporting_ == ErrorReporting::FirstError && errors.size() > 1)
+            errors.erase(std::next(errors.begin()), errors.end());
+        *errorCollector_ = std::move(errors);
+    }
+
+    // Errors of all nested readers are stored in the collector of the root reader. In the ErrorReporting::FirstError
+    // mode, loading stops after the first error.
+    void reportError(const ConfigError& error, const StreamPosition& position)
+    {
+        if (isLoadingStopped())
+            return;
+        errorCollector_->push_back({error.what(), position});
+    }
+
+    bool isLoadingStopped() const
+    {
+        return errorReporting_ == ErrorReporting::FirstError && !errorCollector_->empty();
+    }
+
+    static ConfigErrorList makeErrorList(const ConfigError& error)
+    {
+        return ConfigErrorList{{ConfigErrorInfo{error.what(), {}}}};
+    }
+
+    template<typename T>
+    T valueOrThrow(Expected<T, ConfigErrorList>&& result)
+    {
+        if (!result) {
+            if (errorReporting_ == ErrorReporting::FirstError)
+                detail::throwError(ConfigError{result.error().errors().front().message});
+            detail::throwError(std::move(result).error());
+        }
+        return std::move(*result);
+    }
+
+    detail::ConfigReaderPtr makeNestedReader(
+            const std::string& name,
+            bool canDeferValidation = true,
+            bool canMoveTreeValues = true)
+    {
+        nestedReaders_.emplace(name, std::make_unique<ConfigReader>(nameFormat_, errorReporting_));
+        nestedReaders_[name]->treeOrigins_ = treeOrigins_;
+        nestedReaders_[name]->errorCollector_ = errorCollector_;
+        nestedReaders_[name]->deferredValidators_ = canDeferValidation ? deferredValidators_ : nullptr;
+        nestedReaders_[name]->validationExecutor_ = validationExecutor_;
+        nestedReaders_[name]->readObserver_ = readObserver_;
+        nestedReaders_[name]->memoryResource_ = memoryResource_;
+        nestedReaders_[name]->canMoveTreeValues_ = canMoveTreeValues_ && canMoveTreeValues;
+        return nestedReaders_[name]->makePtr();
+    }
+
+    template<typename TCfg, RootType rootType = RootType::SingleNode>
+    auto read(std::istream& configStream, IParser& parser)
+            -> std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>
+    {
+        auto tree = parse(configStream, parser);
+        return valueOrThrow(readTree<TCfg, rootType>(std::move(tree)));
+    }
+
+    Tree parse(std::istream& configStream, IParser& parser)
+    {
+        auto observedPhase = detail::ObservedReadPhase{
+                readObserver_,
+                ReadPhase::Parse,
+                {},
+                readObserver_ ? detail::remainingStreamSize(configStream) : 0};
+        return parser.parse(configStream);
+    }
+
+    // When an observer is attached, file reading is separated from parsing to measure it
+    std::stringstream readFileContent(std::ifstream& configStream)
+    {
+        auto observedPhase = detail::ObservedReadPhase{
+                readObserver_,
+                ReadPhase::FileRead,
+                {},
+                detail::remainingStreamSize(configStream)};
+        auto fileContentStream = std::stringstream{};
+        fileContentStream << configStream.rdbuf();
+        return fileContentStream;
+    }
+
+    template<typename TCfg, RootType rootType = RootType::SingleNode>
+    auto tryRead(std::istream& configStream, IParser& parser)
+            -> Expected<std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>, ConfigErrorList>
+    {
+        auto tree = [&]
+        {
+            auto observedPhase = detail::ObservedReadPhase{
+                    readObserver_,
+                    ReadPhase::Parse,
+                    {},
+                    readObserver_ ? detail::remainingStreamSize(configStream) : 0};
+            return detail::tryParse(parser, configStream);
+        }();
+        if (!tree)
+            return Unexpected{makeErrorList(tree.error())};
+        return readTree<TCfg, rootType>(std::move(*tree));
+    }
+
+    template<typename TCfg>
+    Expected<TCfg, ConfigErrorList> readLayerTrees(
+            const std::vector<ConfigLayer>& layers,
+            const std::vector<Tree>& layerTrees)
+    {
+        auto treeOrigins = detail::TreeOrigins{};
+        auto tree = detail::mergeLayers(layers, layerTrees, treeOrigins);
+        if (!tree)
+            return Unexpected{makeErrorList(tree.error())};
+        return readTree<TCfg>(std::move(*tree), &treeOrigins);
+    }
+
+    template<typename TCfg, RootType rootType = RootType::SingleNode>
+    auto readTree(Tree&& tree, const detail::TreeOrigins* treeOrigins = nullptr)
+            -> Expected<std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>, ConfigErrorList>
+    {
+        // The tree is taken over by the reader, so its values can't be accessed by anyone else after they're moved to the
+        // config fields
+        auto ownedTree = Tree{std::move(tree)};
+        const auto& root = ownedTree.root();
+        auto errors = std::vector<ConfigErrorInfo>{};
+        errorCollector_ = &errors;
+        treeOrigins_ = treeOrigins;
+        canMoveTreeValues_ = true;
+        auto cfgList = std::vector<TCfg>{};
+        if (root.isList()) {
+            cfgList.reserve(root.asList().size());
+            for (auto i = 0; i < root.asList().size() && !isLoadingStopped(); ++i)
+                cfgList.emplace_back(readConfig<TCfg>(root.asList().at(i)));
+        }
+        else
+            cfgList.emplace_back(readConfig<TCfg>(root));
+        errorCollector_ = nullptr;
+        treeOrigins_ = nullptr;
+        canMoveTreeValues_ = false;
+
+        if (!errors.empty()) {
+            // In the ErrorReporting::AllErrors mode, errors are returned in the document order
+            auto positionOrder = [](const StreamPosition& position)
+            {
+                const auto noPosition = std::numeric_limits<int>::max();
+                return std::make_pair(position.line.value_or(noPosition), position.column.value_or(noPosition));
+            };
+            std::stable_sort(
+                    errors.begin(),
+                    errors.end(),
+                    [&](const ConfigErrorInfo& lhs, const ConfigErrorInfo& rhs)
+                    {
+                        return positionOrder(lhs.position) < positionOrder(rhs.position);
+                    });
+            return Unexpected{ConfigErrorList{std::move(errors)}};
+        }
+
+        if constexpr (rootType == RootType::SingleNode) {
+            if (cfgList.size() != 1)
+                return Unexpected{makeErrorList(ConfigError{
+                        "Expected a single element root of the document, use 'readList*' methods instead"})};
+
+            return std::move(cfgList.at(0));
+        }
+        else
+            return cfgList;
+    }
+
+    void clear()
+    {
+        nodes_.clear();
+        params_.clear();
+        nestedReaders_.clear();
+        validators_.clear();
+        entityLayers_.clear();
+    }
+
+    // Deferred validators of the loaded node list element reference its fields and entities, so they're kept until the
+    // end of reading
+    void clearNodeListElement()
+    {
+        if (deferredValidators_ && deferredValidators_->size() != deferredValidatorCount_) {
+            auto element = std::make_unique<ConfigReader>(nameFormat_, errorReporting_);
+            element->nodes_ = std::move(nodes_);
+            element->params_ = std::move(params_);
+            element->nestedReaders_ = std::move(nestedReaders_);
+            element->validators_ = std::move(validators_);
+            loadedNodeListElements_.push_back(std::move(element));
+            deferredValidatorCount_ = deferredValidators_->size();
+        }
+        clear();
+    }
+
+    detail::ConfigReaderPtr makePtr()
+    {
+        return this;
+    }
+
+    template<typename TCfg>
+    void resetConfigReader(TCfg& cfg)
+    {
+        cfg.cfgReader_ = detail::ConfigReaderPtr{};
+    }
+
+    // Fields are loaded according to the compile time schema of the config, so the reader and the schema can't disagree
+    template<std::size_t fieldIndex, typename TCfg, typename TField>
+    void loadField(TField& field)
+    {
+        constexpr const auto& fieldSchema = detail::configSchemaFields<TCfg, NameFormat::Original>[fieldIndex];
+        const auto name = std::string{fieldSchema.name};
+        detail::bindMemoryResource(field, memoryResource_);
+        if constexpr (fieldSchema.kind == FieldKind::Param) {
+            auto paramCreator = detail::ParamCreator{makePtr(), name, field, fieldSchema.isOptional};
+            detail::setFieldValidators<TCfg, fieldIndex>(paramCreator);
+            paramCreator.createParam();
+        }
+        else if constexpr (fieldSchema.kind == FieldKind::Dict) {
+            static_assert(
+                    detail::canBeReadAsParam<typename eel::remove_optional_t<TField>::mapped_type>(),
+                    "Dict value type must be readable from stringtream or registered with StringConverter");
+            auto dictCreator = detail::DictCreator{makePtr(), name, field, fieldSchema.isOptional};
+            detail::setFieldValidators<TCfg, fieldIndex>(dictCreator);
+            dictCreator.createDict();
+        }
+        else if constexpr (fieldSchema.kind == FieldKind::ParamList) {
+            auto paramListCreator = detail::ParamListCreator{makePtr(), name, field, fieldSchema.isOptional};
+            detail::setFieldValidators<TCfg, fieldIndex>(paramListCreator);
+            paramListCreator.createParamList();
+        }
+        else if constexpr (fieldSchema.kind == FieldKind::NodeList) {
+            auto nodeListCreator = detail::NodeListCreator<TField, detail::CreatorMode::StaticReflection>{
+                    makePtr(),
+                    name,
+                    field,
+                    fieldSchema.isCopyNodeList ? detail::NodeListType::Copy : detail::NodeListType::Normal,
+                    fieldSchema.isOptional};
+            detail::setFieldValidators<TCfg, fieldIndex>(nodeListCreator);
+            nodeListCreator.createNodeList();
+        }
+        else {
+            auto nodeCreator = detail::NodeCreator<TField, detail::CreatorMode::StaticReflection>{
+                    makePtr(),
+                    name,
+                    field,
+                    fieldSchema.isOptional};
+            detail::setFieldValidators<TCfg, fieldIndex>(nodeCreator);
+            nodeCreator.createNode();
+        }
+    }
+
+    template<typename TCfg, std::size_t... indices>
+    void loadStructure(TCfg& cfg, std::index_sequence<indices...>)
+    {
+        (loadField<indices, TCfg>(pfr::get<indices>(cfg)), ...);
+    }
+
+    template<typename TCfg>
+    void loadStructure(TCfg& cfg)
+    {
+#if (defined(_MSVC_LANG) && _MSVC_LANG < 202002L) || (!defined(_MSVC_LANG) && __cplusplus < 202002L)
+        static_assert(
+                eel::dependent_false<TCfg>,
+                "Static reflection interface requires C++20. Inherit from figcone::Config to use runtime reflection "
+                "interface");
+#endif
+        loadStructure(cfg, std::make_index_sequence<pfr::tuple_size_v<TCfg>>{});
+    }
+
+    template<typename TCfg>
+    void postProcess(TCfg& cfg)
+    {
+        // post-processors expect a fully loaded config, so they're skipped when loading errors were collected
+        if (!errorCollector_->empty())
+            return;
+
+        auto observedPhase = detail::ObservedReadPhase{readObserver_, ReadPhase::PostProcessing};
+        auto errorMsg = detail::catchErrorMessage<ValidationError>(
+                [&]
+                {
+                    PostProcessor<TCfg>{}(cfg);
+                });
+        if (errorMsg)
+            reportError(ConfigError{"Config is invalid: " + *errorMsg}, {});
+    }
+
+    template<typename TCfg>
+    void loadRoot(const figcone::TreeNode& root)
+    {
+        auto observedPhase = detail::ObservedReadPhase{
+                readObserver_,
+                ReadPhase::Load,
+                {},
+                0,
+                readObserver_ ? detail::treeNodeElementCount(root) : 0};
+        load<TCfg>(root, "Root node: ");
+    }
+
+    template<typename TCfg>
+    TCfg readConfig(const figcone::TreeNode& root)
+    {
+        clear();
+        auto deferredValidators = std::vector<detail::DeferredValidator>{};
+        deferredValidators_ = validationExecutor_ ? &deferredValidators : nullptr;
+
+        if constexpr (!std::is_base_of_v<figcone::Config, TCfg>) {
+            if constexpr (!std::is_aggregate_v<TCfg>)
+                static_assert(
+                        std::is_constructible_v<TCfg, detail::ConfigReaderPtr>,
+                        "Static reflection interface isn't compatible with non-aggregate types. Inherit from "
+                        "figcone::Config to use runtime reflection interface");
+
+            auto cfg = TCfg{};
+            loadStructure(cfg);
+            loadRoot<TCfg>(root);
+            deferredValidators_ = nullptr;
+            runDeferredValidators(deferredValidators);
+            postProcess(cfg);
+            return cfg;
+        }
+        else {
+            if constexpr (!std::is_aggregate_v<TCfg>)
+                static_assert(
+                        std::is_constructible_v<TCfg, detail::ConfigReaderPtr>,
+                        "Non aggregate config objects must inherit figcone::Config constructors with 'using "
+                        "Config::Config;'");
+
+            auto cfg = TCfg{makePtr()};
+            loadRoot<TCfg>(root);
+            deferredValidators_ = nullptr;
+            runDeferredValidators(deferredValidators);
+            postProcess(cfg);
+            resetConfigReader(cfg);
+            return cfg;
+        }
+    }
+
+private:
+    template<typename TConfigReaderPtr>
+    friend class detail::ConfigReaderAccess;
+
+private:
+    std::map<std::string, std::unique_ptr<detail::INode>> nodes_;
+    std::map<std::string, std::unique_ptr<detail::IParam>> params_;
+    std::map<std::string, std::unique_ptr<ConfigReader>> nestedReaders_;
+    std::vector<std::unique_ptr<detail::IValidator>> validators_;
+    std::vector<std::unique_ptr<ConfigReader>> loadedNodeListElements_;
+    std::vector<detail::RegisteredField>* registeredFields_ = nullptr;
+    const detail::TreeOrigins* treeOrigins_ = nullptr;
+    std::unordered_map<const detail::IConfigEntity*, std::string> entityLayers_;
+    std::vector<ConfigErrorInfo>* errorCollector_ = nullptr;
+    std::vector<detail::DeferredValidator>* deferredValidators_ = nullptr;
+    std::size_t deferredValidatorCount_ = 0;
+    IValidationExecutor* validationExecutor_ = nullptr;
+    IReadObserver* readObserver_ = nullptr;
+    std::pmr::memory_resource* memoryResource_ = nullptr;
+    bool canMoveTreeValues_ = false;
+    NameFormat nameFormat_;
+    ErrorReporting errorReporting_;
+};
+
+} //namespace figcone
+
+// All reading methods of ConfigReader load configs through readTree, so its explicit instantiation compiles the loading
+// code of a config type and of all its nested nodes. Use FIGCONE_DECLARE_READER in the global namespace of the header
+// with the config definition and FIGCONE_DEFINE_READER in a single translation unit to compile it only once.
+#define FIGCONE_DECLARE_READER(TCfg)                                                                                   \
+    extern template auto figcone::ConfigReader::readTree<TCfg, figcone::RootType::SingleNode>(                         \
+            figcone::Tree&&,                                                                                           \
+            const figcone::detail::TreeOrigins*) -> figcone::Expected<TCfg, figcone::ConfigErrorList>;                 \
+    extern template auto figcone::ConfigReader::readTree<TCfg, figcone::RootType::NodeList>(                           \
+            figcone::Tree&&,                                                                                           \
+            const figcone::detail::TreeOrigins*) -> figcone::Expected<std::vector<TCfg>, figcone::ConfigErrorList>
+
+#define FIGCONE_DEFINE_READER(TCfg)                                                                                    \
+    template auto figcone::ConfigReader::readTree<TCfg, figcone::RootType::SingleNode>(                                \
+            figcone::Tree&&,                                                                                           \
+            const figcone::detail::TreeOrigins*) -> figcone::Expected<TCfg, figcone::ConfigErrorList>;                 \
+    template auto figcone::ConfigReader::readTree<TCfg, figcone::RootType::NodeList>(                                  \
+            figcone::Tree&&,                                                                                           \
+            const figcone::detail::TreeOrigins*) -> figcone::Expected<std::vector<TCfg>, figcone::ConfigErrorList>
+
+#endif //FIGCONE_CONFIGREADERCORE_H
\ No newline at end of file
@@ -0,0 +1,21 @@
+#ifndef FIGCONE_CONFIGSCHEMA_H
+#define FIGCONE_CONFIGSCHEMA_H
+
+#include "fieldschema.h"
+#include "nameformat.h"
+#include "detail/schema.h"
+
+namespace figcone {
+
+// Returns the description of the fields of a config structure, with the field names converted to the specified name
+// format. The schema of a static reflection config is available at compile time, the schema of a runtime reflection
+// config is created on the first call.
+template<typename TCfg, NameFormat nameFormat = NameFormat::Original>
+constexpr ConfigSchema schema()
+{
+    return detail::configSchema<TCfg, nameFormat>();
+}
+
+} //namespace figcone
+
+#endif //FIGCONE_CONFIGSCHEMA_H
@@ -0,0 +1,221 @@
+#ifndef FIGCONE_CONSTRAINTS_H
+#define FIGCONE_CONSTRAINTS_H
+
+#include "configreadercore.h"
+#include "errors.h"
+#include "fieldschema.h"
+#include "nameformat.h"
+#include "detail/exceptions.h"
+#include "detail/fingerprintutils.h"
+#include "detail/hasher.h"
+#include "detail/schema.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace figcone {
+
+// Set of config constraints that can span multiple config nodes.
+// Each constraint declares the paths of config fields it reads, e.g. "routes" or "server.port", and the names of
+// constraints that must be satisfied before it's checked. Constraints are checked in the order of their
+// prerequisites, and on subsequent checks of the same Constraints object only the constraints whose input fields
+// have changed are evaluated again. A constraint without declared field dependencies depends on the whole config.
+// Changes are detected by the 64-bit hash of the input fields, so the config isn't copied and doesn't need to be
+// copyable.
+template<typename TCfg>
+class Constraints {
+    struct Constraint {
+        std::string name;
+        std::vector<std::vector<std::string>> dependencies;
+        std::vector<std::string> prerequisites;
+        std::function<std::optional<std::string>(const TCfg&)> checkFunc;
+        std::optional<std::uint64_t> inputsHash;
+        std::optional<std::string> errorMsg;
+    };
+
+public:
+    // Checking function must be compatible with void(const TCfg&) and throw figcone::ValidationError, or with
+    // std::optional<std::string>(const TCfg&) and return an error message.
+    template<typename TCheckFunc>
+    Constraints& add(
+            std::string name,
+            const std::vector<std::string>& dependencies,
+            TCheckFunc checkFunc,
+            std::vector<std::string> prerequisites = {})
+    {
+        for (const auto& constraint : constraints_)
+            if (constraint.name == name)
+                detail::throwError(Error{"Constraint '" + name + "' is already added"});
+
+        auto dependencyPaths = std::vector<std::vector<std::string>>{};
+        for (const auto& dependency : dependencies) {
+            dependencyPaths.emplace_back(splitPath(dependency));
+            if (!isFieldPathInSchema(detail::configSchema<TCfg, NameFormat::Original>(), dependencyPaths.back(), 0))
+                detail::throwError(Error{"Constraint '" + name + "' depends on unknown field '" + dependency + "'"});
+        }
+
+        constraints_.push_back(
+                {std::move(name),
+                 std::move(dependencyPaths),
+                 std::move(prerequisites),
+                 [checkFunc = std::move(checkFunc)](const TCfg& cfg) -> std::optional<std::string>
+                 {
+                     if constexpr (std::is_void_v<std::invoke_result_t<const TCheckFunc&, const TCfg&>>)
+                         return detail::catchErrorMessage<ValidationError>(
+                                 [&]
+                                 {
+                                     checkFunc(cfg);
+                                 });
+                     else
+                         return checkFunc(cfg);
+                 },
+                 std::nullopt,
+                 std::nullopt});
+        order_.clear();
+        return *this;
+    }
+
+    // Returns errors of all unsatisfied constraints. Constraints with unsatisfied prerequisites aren't checked.
+    std::optional<ConfigErrorList> tryCheck(const TCfg& cfg)
+    {
+        if (order_.empty())
+            sortConstraints();
+
+        // the whole config is hashed once for all constraints without declared field dependencies
+        auto cfgHash = std::optional<std::uint64_t>{};
+        auto errors = std::vector<ConfigErrorInfo>{};
+        auto isSatisfied = std::vector<bool>(constraints_.size(), false);
+        for (auto index : order_) {
+            auto& constraint = constraints_[index];
+            auto hasUnsatisfiedPrerequisite = false;
+            for (const auto& prerequisite : constraint.prerequisites)
+                if (!isSatisfied[constraintIndex(prerequisite)])
+                    hasUnsatisfiedPrerequisite = true;
+            if (hasUnsatisfiedPrerequisite) {
+                constraint.inputsHash.reset();
+                continue;
+            }
+
+            const auto inputsHash = hashInputs(constraint, cfg, cfgHash);
+            if (constraint.inputsHash != inputsHash) {
+                constraint.errorMsg = constraint.checkFunc(cfg);
+                constraint.inputsHash = inputsHash;
+            }
+            if (constraint.errorMsg)
+                errors.push_back({"Constraint '" + constraint.name + "': " + *constraint.errorMsg, {}});
+            else
+                isSatisfied[index] = true;
+        }
+
+        if (!errors.empty())
+            return ConfigErrorList{std::move(errors)};
+        return std::nullopt;
+    }
+
+    // Throws figcone::ConfigErrorList if any of the constraints isn't satisfied
+    void check(const TCfg& cfg)
+    {
+        if (auto errors = tryCheck(cfg))
+            detail::throwError(std::move(*errors));
+    }
+
+    // Forces evaluation of all constraints on the next check
+    void reset()
+    {
+        for (auto& constraint : constraints_)
+            constraint.inputsHash.reset();
+    }
+
+private:
+    static std::vector<std::string> splitPath(const std::string& path)
+    {
+        auto result = std::vector<std::string>{};
+        auto pos = std::size_t{0};
+        while (true) {
+            const auto delimPos = path.find('.', pos);
+            result.emplace_back(path.substr(pos, delimPos - pos));
+            if (delimPos == std::string::npos)
+                return result;
+            pos = delimPos + 1;
+        }
+    }
+
+    static bool isFieldPathInSchema(
+            ConfigSchema schema,
+            const std::vector<std::string>& path,
+            std::size_t pathIndex)
+    {
+        const auto field = schema.find(path[pathIndex]);
+        if (!field)
+            return false;
+        if (pathIndex + 1 == path.size())
+            return true;
+        return isFieldPathInSchema(field->nestedSchema(), path, pathIndex + 1);
+    }
+
+    static std::uint64_t hashInputs(
+            const Constraint& constraint,
+            const TCfg& cfg,
+            std::optional<std::uint64_t>& cfgHash)
+    {
+        auto hasher = detail::Hasher{};
+        if (constraint.dependencies.empty()) {
+            if (!cfgHash) {
+                detail::hashValue(hasher, cfg);
+                cfgHash = hasher.result();
+            }
+            return *cfgHash;
+        }
+
+        for (const auto& path : constraint.dependencies)
+            detail::hashFieldPath(hasher, cfg, path, 0);
+        return hasher.result();
+    }
+
+    std::size_t constraintIndex(const std::string& name) const
+    {
+        for (auto i = std::size_t{0}; i < constraints_.size(); ++i)
+            if (constraints_[i].name == name)
+                return i;
+        detail::throwError(Error{"Unknown constraint '" + name + "'"});
+    }
+
+    // Stable topological sort: constraints without dependencies between them keep the order of their addition
+    void sortConstraints()
+    {
+        auto isSorted = std::vector<bool>(constraints_.size(), false);
+        while (order_.size() < constraints_.size()) {
+            const auto sortedCount = order_.size();
+            for (auto i = std::size_t{0}; i < constraints_.size(); ++i) {
+                if (isSorted[i])
+                    continue;
+                auto isReady = true;
+                for (const auto& prerequisite : constraints_[i].prerequisites)
+                    if (!isSorted[constraintIndex(prerequisite)])
+                        isReady = false;
+                if (!isReady)
+                    continue;
+                isSorted[i] = true;
+                order_.push_back(i);
+                break;
+            }
+            if (order_.size() == sortedCount) {
+                order_.clear();
+                detail::throwError(Error{"Constraint prerequisites contain a cycle"});
+            }
+        }
+    }
+
+private:
+    std::vector<Constraint> constraints_;
+    std::vector<std::size_t> order_;
+};
+
+} //namespace figcone
+
+#endif //FIGCONE_CONSTRAINTS_H
@@ -0,0 +1,109 @@
+#ifndef FIGCONE_COMMANDLINEMAPPING_H
+#define FIGCONE_COMMANDLINEMAPPING_H
+
+#include "exceptions.h"
+#include "nameutils.h"
+#include "parampathindex.h"
+#include "paramtreebuilder.h"
+#include "schema.h"
+#include <figcone/errors.h>
+#include <figcone/nameformat.h>
+#include <figcone_tree/tree.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace figcone::detail {
+
+template<typename TCfg, NameFormat nameFormat>
+const ParamPathIndex& commandLineMapping()
+{
+    static const auto mapping = ParamPathIndex{
+            configSchema<TCfg, NameFormat::Original>(),
+            nameFormat,
+            [](std::string_view fieldName)
+            {
+                return convertName(nameFormat, fieldName);
+            },
+            "."};
+    return mapping;
+}
+
+template<typename TCfg>
+const ParamPathIndex& commandLineMapping(NameFormat nameFormat)
+{
+    switch (nameFormat) {
+    case NameFormat::SnakeCase:
+        return commandLineMapping<TCfg, NameFormat::SnakeCase>();
+    case NameFormat::CamelCase:
+        return commandLineMapping<TCfg, NameFormat::CamelCase>();
+    case NameFormat::KebabCase:
+        return commandLineMapping<TCfg, NameFormat::KebabCase>();
+    default:
+        return commandLineMapping<TCfg, NameFormat::Original>();
+    }
+}
+
+inline std::vector<std::string> splitCommandLineFlagName(const std::string& flag, std::string_view flagName)
+{
+    auto result = std::vector<std::string>{};
+    auto pos = std::size_t{};
+    while (true) {
+        auto delimiterPos = flagName.find('.', pos);
+        auto segment = flagName.substr(pos, delimiterPos - pos);
+        if (segment.empty())
+            throwError(ConfigError{"Command line flag '" + flag + "' has an invalid name"});
+        result.emplace_back(segment);
+        if (delimiterPos == std::string_view::npos)
+            return result;
+        pos = delimiterPos + 1;
+    }
+}
+
+inline bool isCommandLineFlag(const std::string& arg)
+{
+    return arg.compare(0, 2, "--") == 0;
+}
+
+// Values starting with '--' can only be passed in the '--flag=value' form.
+// Flags of the unknown parameters are added to the tree too, so they are reported by UnregisteredFieldHandler
+// of the config structure that contains them.
+inline Tree readCommandLine(const ParamPathIndex& mapping, const std::vector<std::string>& args)
+{
+    auto treeBuilder = ParamTreeBuilder{};
+    for (auto i = std::size_t{}; i < args.size(); ++i) {
+        const auto& arg = args[i];
+        if (arg.size() <= 2 || !isCommandLineFlag(arg))
+            throwError(ConfigError{"Command line argument '" + arg + "' must be a flag starting with '--'"});
+
+        auto flagName = std::string_view{arg}.substr(2);
+        auto value = std::string{};
+        auto valuePos = flagName.find('=');
+        if (valuePos != std::string_view::npos) {
+            value = std::string{flagName.substr(valuePos + 1)};
+            flagName = flagName.substr(0, valuePos);
+        }
+        else if (i + 1 < args.size() && !isCommandLineFlag(args[i + 1]))
+            value = args[++i];
+        else
+            throwError(ConfigError{"Command line flag '" + arg + "' has no value"});
+
+        if (auto target = mapping.find(flagName)) {
+            if (target->isParamList)
+                treeBuilder.addParamListValue(target->nodePath, target->paramName, std::move(value));
+            else
+                treeBuilder.setParam(target->nodePath, target->paramName, std::move(value));
+            continue;
+        }
+
+        auto nodePath = splitCommandLineFlagName(arg, flagName);
+        auto paramName = std::move(nodePath.back());
+        nodePath.pop_back();
+        treeBuilder.setParam(nodePath, paramName, std::move(value));
+    }
+    return treeBuilder.makeTree();
+}
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_COMMANDLINEMAPPING_H
@@ -0,0 +1,30 @@
+#ifndef FIGCONE_CONFIGFILE_H
+#define FIGCONE_CONFIGFILE_H
+
+#include "external/eel/path.h"
+#include <figcone/errors.h>
+#include <figcone/expected.h>
+#include <filesystem>
+#include <fstream>
+
+namespace figcone::detail {
+
+inline Expected<std::ifstream, ConfigError> openConfigFile(const std::filesystem::path& configFile)
+{
+    if (!std::filesystem::exists(configFile))
+        return Unexpected{ConfigError{"Config file " + eel::to_string(configFile) + " doesn't exist"}};
+
+    if (!std::filesystem::is_regular_file(configFile))
+        return Unexpected{ConfigError{
+                "Can't open config file " + eel::to_string(configFile) + " which is not a regular file"}};
+
+    auto configStream = std::ifstream{configFile, std::ios_base::binary};
+    if (!configStream.is_open())
+        return Unexpected{ConfigError{"Can't open config file " + eel::to_string(configFile) + " for reading"}};
+
+    return configStream;
+}
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_CONFIGFILE_H
@@ -2,17 +2,47 @@
 #define FIGCONE_CONFIGMACROS_H
 
 #include "dictcreator.h"
+#include "fieldlist.h"
 #include "nodecreator.h"
 #include "nodelistcreator.h"
 #include "paramcreator.h"
 #include "paramlistcreator.h"
+#include <type_traits>
 
-#define FIGCONE_PARAM(name, type) type name = param<&std::remove_pointer_t<decltype(this)>::name>(#name)
-#define FIGCONE_NODE(name, type) type name = node<&std::remove_pointer_t<decltype(this)>::name>(#name)
+// Adds the field to the compile time field list of the config, which is used by fingerprint(), equal() and footprint().
+// The declarations aren't defined and are only used in unevaluated operands, so they don't generate any code.
+#define FIGCONE_FIELD_LIST_ENTRY(name)                                                                                 \
+    enum {                                                                                                             \
+        figconeFieldNumber_##name =                                                                                    \
+                decltype(figconeFieldCount(figcone::detail::FieldRank<figcone::detail::maxFieldCount>{}))::value + 1   \
+    };                                                                                                                 \
+    static_assert(                                                                                                     \
+            figconeFieldNumber_##name <= figcone::detail::maxFieldCount,                                               \
+            "Config can't have more than 256 fields declared with FIGCONE_* macros");                            \
+    static auto figconeFieldCount(figcone::detail::FieldRank<figconeFieldNumber_##name>)                               \
+            -> std::integral_constant<int, figconeFieldNumber_##name>;                                                 \
+    template<typename TFigconeCfg>                                                                                     \
+    friend auto figconeFields(figcone::detail::FieldRank<figconeFieldNumber_##name>, const TFigconeCfg& figconeCfg)    \
+            -> decltype(figcone::detail::appendField<&TFigconeCfg::name>(                                              \
+                    figconeFields(figcone::detail::FieldRank<figconeFieldNumber_##name - 1>{}, figconeCfg)))
+
+#define FIGCONE_PARAM(name, type)                                                                                      \
+    FIGCONE_FIELD_LIST_ENTRY(name);                                                                                    \
+    type name = param<&std::remove_pointer_t<decltype(this)>::name>(#name)
+#define FIGCONE_NODE(name, type)                                                                                       \
+    FIGCONE_FIELD_LIST_ENTRY(name);                                                                                    \
+    type name = node<&std::remove_pointer_t<decltype(this)>::name>(#name)
 #define FIGCONE_COPY_NODELIST(name, listType)                                                                          \
+    FIGCONE_FIELD_LIST_ENTRY(name);                                                                                    \
     listType name = copyNodeList<&std::remove_pointer_t<decltype(this)>::name>(#name)
-#define FIGCONE_NODELIST(name, listType) listType name = nodeList<&std::remove_pointer_t<decltype(this)>::name>(#name)
-#define FIGCONE_PARAMLIST(name, listType) listType name = paramList<&std::remove_pointer_t<decltype(this)>::name>(#name)
-#define FIGCONE_DICT(name, mapType) mapType name = dict<&std::remove_pointer_t<decltype(this)>::name>(#name)
+#define FIGCONE_NODELIST(name, listType)                                                                               \
+    FIGCONE_FIELD_LIST_ENTRY(name);                                                                                    \
+    listType name = nodeList<&std::remove_pointer_t<decltype(this)>::name>(#name)
+#define FIGCONE_PARAMLIST(name, listType)                                                                              \
+    FIGCONE_FIELD_LIST_ENTRY(name);                                                                                    \
+    listType name = paramList<&std::remove_pointer_t<decltype(this)>::name>(#name)
+#define FIGCONE_DICT(name, mapType)                                                                                    \
+    FIGCONE_FIELD_LIST_ENTRY(name);                                                                                    \
+    mapType name = dict<&std::remove_pointer_t<decltype(this)>::name>(#name)
 
-#endif //FIGCONE_CONFIGMACROS_H
\ No newline at end of file
+#endif //FIGCONE_CONFIGMACROS_H
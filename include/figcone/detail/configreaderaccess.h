@@ -2,11 +2,15 @@
 #define FIGCONE_CONFIGREADERACCESS_H
 
 #include "configreaderptr.h"
+#include "registeredfield.h"
 #include <memory>
+#include <memory_resource>
 #include <string>
+#include <vector>
 
 namespace figcone {
 class TreeNode;
+class IReadObserver;
 }
 
 namespace figcone::detail {
@@ -37,10 +41,21 @@ public:
         configReader_->addValidator(std::move(validator));
     }
 
+    void addRegisteredField(const std::string& name, bool isCopyNodeList)
+    {
+        configReader_->addRegisteredField(name, isCopyNodeList);
+    }
+
+    template<typename TCfg>
+    std::vector<RegisteredField> collectRegisteredFields()
+    {
+        return configReader_->template collectRegisteredFields<TCfg>();
+    }
+
     template<typename TCfg>
-    void load(const TreeNode& treeNode)
+    void load(const TreeNode& treeNode, const std::string& errorMsgPrefix)
     {
-        configReader_->template load<TCfg>(treeNode);
+        configReader_->template load<TCfg>(treeNode, errorMsgPrefix);
     }
 
     template<typename TCfg>
@@ -49,11 +64,49 @@ public:
         configReader_->template loadStructure<TCfg>(cfg);
     }
 
+    template<typename TCfg>
+    void resetConfigReader(TCfg& cfg)
+    {
+        configReader_->resetConfigReader(cfg);
+    }
+
+    void clearNodeListElement()
+    {
+        configReader_->clearNodeListElement();
+    }
+
+    bool isLoadingStopped() const
+    {
+        return configReader_->isLoadingStopped();
+    }
+
+    IReadObserver* readObserver() const
+    {
+        return configReader_->readObserver_;
+    }
+
+    std::pmr::memory_resource* memoryResource() const
+    {
+        return configReader_->memoryResource_;
+    }
+
     detail::ConfigReaderPtr makeNestedReader(const std::string& name)
     {
         return configReader_->makeNestedReader(name);
     }
 
+    // Validation of node list elements can be deferred only if they're loaded in place, as elements moved into the list
+    // after loading leave validators with references to the destroyed objects.
+    // The first element of a copy node list is loaded for each element, so its values can't be moved from the tree, and
+    // validators of its elements can't be deferred, as they're run after loading of each element.
+    detail::ConfigReaderPtr makeNestedNodeListReader(
+            const std::string& name,
+            bool isCopyNodeList,
+            bool areElementsLoadedInPlace)
+    {
+        return configReader_->makeNestedReader(name, areElementsLoadedInPlace && !isCopyNodeList, !isCopyNodeList);
+    }
+
 private:
     TConfigReaderPtr configReader_;
 };
@@ -0,0 +1,20 @@
+#ifndef FIGCONE_DEFERREDVALIDATOR_H
+#define FIGCONE_DEFERREDVALIDATOR_H
+
+#include "ivalidator.h"
+#include <cstddef>
+#include <string>
+
+namespace figcone::detail {
+
+struct DeferredValidator {
+    IValidator* validator;
+    // number of collected errors at the moment when the validator would have been run during loading
+    std::size_t errorIndex;
+    // names of the config layers that have supplied the validated value
+    std::string layers;
+};
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_DEFERREDVALIDATOR_H
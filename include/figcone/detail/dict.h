@@ -2,30 +2,65 @@
 #define FIGCONE_DICT_H
 
 #include "inode.h"
+#include "memoryresource.h"
 #include "param.h"
+#include "treevalue.h"
 #include "utils.h"
 #include "external/eel/type_traits.h"
 #include <figcone_tree/tree.h>
+#include <algorithm>
+#include <iterator>
 #include <map>
+#include <memory_resource>
+#include <optional>
 #include <string>
 #include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
 
 namespace figcone::detail {
 
+template<typename TMap, typename = void>
+struct has_key_compare : std::false_type {};
+
+template<typename TMap>
+struct has_key_compare<TMap, std::void_t<typename TMap::key_compare>> : std::true_type {};
+
+template<typename TMap>
+constexpr bool isSortedMap()
+{
+    return has_key_compare<TMap>::value;
+}
+
+// Sorted associative containers with random access iterators, like std::flat_map, store elements in contiguous memory
+template<typename TMap>
+constexpr bool isFlatMap()
+{
+    using IteratorCategory = typename std::iterator_traits<typename TMap::iterator>::iterator_category;
+    return isSortedMap<TMap>() && std::is_base_of_v<std::random_access_iterator_tag, IteratorCategory>;
+}
+
 template<typename TMap>
 class Dict : public INode {
+    static_assert(
+            eel::is_associative_container_v<eel::remove_optional_t<TMap>>,
+            "Dictionary field must be an associative container or an associative container placed in "
+            "std::optional");
+    static_assert(
+            is_basic_string_v<typename eel::remove_optional_t<TMap>::key_type>,
+            "Dictionary associative container's key type must be std::string or std::pmr::string");
+
+    using Map = eel::remove_optional_t<TMap>;
+    using Key = typename Map::key_type;
+    using Value = typename Map::mapped_type;
+
 public:
-    explicit Dict(std::string name, TMap& dictMap)
+    explicit Dict(std::string name, TMap& dictMap, std::pmr::memory_resource* memoryResource = nullptr)
         : name_{std::move(name)}
         , dictMap_{dictMap}
+        , memoryResource_{memoryResource}
     {
-        static_assert(
-                eel::is_associative_container_v<eel::remove_optional_t<TMap>>,
-                "Dictionary field must be an associative container or an associative container placed in "
-                "std::optional");
-        static_assert(
-                std::is_same_v<typename eel::remove_optional_t<TMap>::key_type, std::string>,
-                "Dictionary associative container's key type must be std::string");
     }
 
     void markValueIsSet()
@@ -34,36 +69,91 @@ public:
     }
 
 private:
-    void load(const TreeNode& node) override
+    std::optional<ConfigError> load(const TreeNode& node, bool canMoveTreeValues) override
     {
         hasValue_ = true;
         position_ = node.position();
-        dictMap_ = TMap{};
+        resetWithMemoryResource(dictMap_, memoryResource_);
         if (!node.isItem())
-            throw ConfigError{"Dictionary '" + name_ + "': config node can't be a list.", node.position()};
-        if constexpr (eel::is_optional_v<TMap>)
-            dictMap_.emplace();
+            return ConfigError{"Dictionary '" + name_ + "': config node can't be a list.", node.position()};
 
-        for (const auto& paramName : node.asItem().paramNames()) {
-            const auto& paramValue = node.asItem().param(paramName);
-            using Param = typename eel::remove_optional_t<TMap>::mapped_type;
-            const auto paramNameStr = paramName;
-            const auto paramValueStr = paramValue;
-            auto paramReadResult = convertFromString<Param>(paramValueStr.value());
-            auto readResultVisitor = eel::overloaded{
-                    [&](const Param& param)
+        // param names are returned by value, so they're moved to the dictionary keys
+        auto paramNames = node.asItem().paramNames();
+        auto& dictMap = maybeOptValue(dictMap_);
+        if constexpr (is_reservable_v<Map>)
+            dictMap.reserve(paramNames.size());
+
+        if constexpr (isFlatMap<Map>()) {
+            // inserting the elements sorted in advance at the end of a flat map doesn't shift the stored ones
+            auto elements = std::vector<std::pair<Key, Value>>{};
+            elements.reserve(paramNames.size());
+            auto error = readElements(
+                    node,
+                    paramNames,
+                    canMoveTreeValues,
+                    [&](Key&& key, Value&& value)
+                    {
+                        elements.emplace_back(std::move(key), std::move(value));
+                    });
+            if (error)
+                return error;
+
+            std::sort(
+                    elements.begin(),
+                    elements.end(),
+                    [keyCompare = dictMap.key_comp()](const auto& lhs, const auto& rhs)
                     {
-                        maybeOptValue(dictMap_).emplace(paramNameStr, param);
-                    },
-                    [&](const StringConversionError& error)
+                        return keyCompare(lhs.first, rhs.first);
+                    });
+            for (auto& [key, value] : elements)
+                dictMap.emplace_hint(dictMap.end(), std::move(key), std::move(value));
+            return std::nullopt;
+        }
+        else
+            return readElements(
+                    node,
+                    paramNames,
+                    canMoveTreeValues,
+                    [&](Key&& key, Value&& value)
                     {
-                        throw ConfigError{
-                                "Couldn't set dict element'" + name_ + "' value from '" + paramValueStr.value() + "'" +
-                                        (!error.message.empty() ? ": " + error.message : ""),
-                                position_};
-                    }};
-            std::visit(readResultVisitor, paramReadResult);
+                        // config trees usually store params in sorted order, so it's an amortized constant time
+                        // insertion for ordered maps
+                        if constexpr (isSortedMap<Map>())
+                            dictMap.emplace_hint(dictMap.end(), std::move(key), std::move(value));
+                        else
+                            dictMap.emplace(std::move(key), std::move(value));
+                    });
+    }
+
+    template<typename TStoreElement>
+    std::optional<ConfigError> readElements(
+            const TreeNode& node,
+            std::vector<std::string>& paramNames,
+            bool canMoveTreeValues,
+            TStoreElement&& storeElement)
+    {
+        for (auto& paramName : paramNames) {
+            const auto& paramValue = node.asItem().param(paramName);
+            if constexpr (canBeMovedFromTree<Value>()) {
+                if (canMoveTreeValues) {
+                    storeElement(
+                            makeWithMemoryResource<Key>(memoryResource_, std::move(paramName)),
+                            takeTreeValue(paramValue.value()));
+                    continue;
+                }
+            }
+            auto paramReadResult = convertFromString<Value>(paramValue.value());
+            if (auto error = std::get_if<StringConversionError>(&paramReadResult))
+                return ConfigError{
+                        "Couldn't set dict element'" + name_ + "' value from '" + paramValue.value() + "'" +
+                                (!error->message.empty() ? ": " + error->message : ""),
+                        position_};
+
+            storeElement(
+                    makeWithMemoryResource<Key>(memoryResource_, std::move(paramName)),
+                    withMemoryResource(std::move(std::get<Value>(paramReadResult)), memoryResource_));
         }
+        return std::nullopt;
     }
 
     bool hasValue() const override
@@ -87,6 +177,7 @@ private:
 private:
     std::string name_;
     TMap& dictMap_;
+    std::pmr::memory_resource* memoryResource_;
     bool hasValue_ = false;
     StreamPosition position_;
 };
@@ -3,11 +3,14 @@
 
 #include "configreaderaccess.h"
 #include "dict.h"
+#include "memoryresource.h"
+#include "utils.h"
 #include "validator.h"
 #include "external/eel/contract.h"
 #include "external/eel/type_traits.h"
 #include <figcone/nameformat.h>
 #include <memory>
+#include <memory_resource>
 
 namespace figcone::detail {
 
@@ -16,8 +19,9 @@ class DictCreator {
 public:
     DictCreator(ConfigReaderPtr cfgReader, std::string dictName, TMap& dictMap, bool isOptional = false)
         : cfgReader_{cfgReader}
+        , memoryResource_{cfgReader_ ? ConfigReaderAccess{cfgReader_}.memoryResource() : nullptr}
         , dictName_{(eel::precondition(!dictName.empty(), FIGCONE_EEL_LINE), std::move(dictName))}
-        , dict_{std::make_unique<Dict<TMap>>(dictName_, dictMap)}
+        , dict_{std::make_unique<Dict<TMap>>(dictName_, dictMap, memoryResource_)}
         , dictMap_{dictMap}
     {
         static_assert(
@@ -25,8 +29,8 @@ public:
                 "Dictionary field must be an associative container or an associative container placed in "
                 "std::optional");
         static_assert(
-                std::is_same_v<typename eel::remove_optional_t<TMap>::key_type, std::string>,
-                "Dictionary associative container's key type must be std::string");
+                is_basic_string_v<typename eel::remove_optional_t<TMap>::key_type>,
+                "Dictionary associative container's key type must be std::string or std::pmr::string");
         if (isOptional)
             dict_->markValueIsSet();
     }
@@ -47,28 +51,38 @@ public:
     operator TMap()
     {
         createDict();
-        return defaultValue_;
+        return withMemoryResource(defaultValue_, memoryResource_);
     }
 
-    DictCreator& ensure(std::function<void(const eel::remove_optional_t<TMap>&)> validatingFunc)
+    template<typename TValidatingFunc>
+    DictCreator& ensure(TValidatingFunc&& validatingFunc)
     {
-        if (cfgReader_)
-            ConfigReaderAccess{cfgReader_}.addValidator(
-                    std::make_unique<Validator<TMap>>(*dict_, dictMap_, std::move(validatingFunc)));
+        addValidator(std::forward<TValidatingFunc>(validatingFunc));
         return *this;
     }
 
     template<typename TValidator, typename... TArgs>
     DictCreator& ensure(TArgs&&... args)
+    {
+        addValidator(TValidator{std::forward<TArgs>(args)...});
+        return *this;
+    }
+
+private:
+    template<typename TValidatingFunc>
+    void addValidator(TValidatingFunc&& validatingFunc)
     {
         if (cfgReader_)
             ConfigReaderAccess{cfgReader_}.addValidator(
-                    std::make_unique<Validator<TMap>>(*dict_, dictMap_, TValidator{std::forward<TArgs>(args)...}));
-        return *this;
+                    std::make_unique<Validator<TMap, std::decay_t<TValidatingFunc>>>(
+                            *dict_,
+                            dictMap_,
+                            std::forward<TValidatingFunc>(validatingFunc)));
     }
 
 private:
     ConfigReaderPtr cfgReader_;
+    std::pmr::memory_resource* memoryResource_;
     std::string dictName_;
     std::unique_ptr<Dict<TMap>> dict_;
     TMap& dictMap_;
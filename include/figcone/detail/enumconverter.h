@@ -0,0 +1,245 @@
+#ifndef FIGCONE_ENUMCONVERTER_H
+#define FIGCONE_ENUMCONVERTER_H
+
+#include "nameof_import.h"
+#include "nameutils.h"
+#include "utils.h"
+#include <figcone/nameformat.h>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+namespace figcone::detail {
+
+// Enums without a StringConverter specialization or a stream extraction operator are read from the names of their
+// enumerators when the nameof library is available
+template<typename T>
+constexpr bool canBeReadAsEnum()
+{
+#ifdef FIGCONE_NAMEOF_AVAILABLE
+    return std::is_enum_v<T> && !is_string_extractable_v<T>;
+#else
+    return false;
+#endif
+}
+
+#ifdef FIGCONE_NAMEOF_AVAILABLE
+
+template<typename TEnum>
+constexpr int enumRangeMin()
+{
+    using Underlying = std::underlying_type_t<TEnum>;
+    constexpr auto rangeMin = nameof::customize::enum_range<TEnum>::min;
+    if constexpr (std::is_unsigned_v<Underlying>)
+        return std::max(rangeMin, 0);
+    else if constexpr (sizeof(Underlying) < sizeof(int))
+        return std::max(rangeMin, static_cast<int>(std::numeric_limits<Underlying>::min()));
+    else
+        return rangeMin;
+}
+
+template<typename TEnum>
+constexpr int enumRangeMax()
+{
+    using Underlying = std::underlying_type_t<TEnum>;
+    constexpr auto rangeMax = nameof::customize::enum_range<TEnum>::max;
+    if constexpr (sizeof(Underlying) < sizeof(int))
+        return std::min(rangeMax, static_cast<int>(std::numeric_limits<Underlying>::max()));
+    else
+        return rangeMax;
+}
+
+// Enumerators are looked up by their names and by the renderings of their names in the formats of figcone::NameFormat
+// and in pascal case, e.g. "DarkRed", "dark_red", "darkRed" and "dark-red" for DarkRed
+enum class EnumKeyFormat {
+    Original,
+    SnakeCase,
+    CamelCase,
+    KebabCase,
+    PascalCase
+};
+
+inline constexpr auto enumKeyFormatCount = std::size_t{5};
+
+template<typename TOutput>
+struct PascalCaseKeyWriter {
+    TOutput& output;
+    bool isFirstChar = true;
+
+    constexpr void push_back(char ch)
+    {
+        output.push_back(isFirstChar ? toNameUpper(ch) : ch);
+        isFirstChar = false;
+    }
+};
+
+struct EnumKeyCharCounter {
+    std::size_t count = 0;
+
+    constexpr void push_back(char)
+    {
+        ++count;
+    }
+};
+
+template<std::size_t keyCharCount>
+struct EnumKeyCharWriter {
+    std::array<char, keyCharCount>& keyChars;
+    std::size_t index = 0;
+
+    constexpr void push_back(char ch)
+    {
+        keyChars[index++] = ch;
+    }
+};
+
+template<typename TOutput>
+constexpr void writeEnumKey(EnumKeyFormat keyFormat, std::string_view name, TOutput& output)
+{
+    switch (keyFormat) {
+    case EnumKeyFormat::Original:
+        for (auto ch : name)
+            output.push_back(ch);
+        return;
+    case EnumKeyFormat::SnakeCase:
+        writeConvertedName(NameFormat::SnakeCase, name, output);
+        return;
+    case EnumKeyFormat::CamelCase:
+        writeConvertedName(NameFormat::CamelCase, name, output);
+        return;
+    case EnumKeyFormat::KebabCase:
+        writeConvertedName(NameFormat::KebabCase, name, output);
+        return;
+    case EnumKeyFormat::PascalCase: {
+        auto pascalCaseOutput = PascalCaseKeyWriter<TOutput>{output};
+        writeConvertedName(NameFormat::CamelCase, name, pascalCaseOutput);
+        return;
+    }
+    }
+}
+
+template<typename TEnum>
+struct EnumNameEntry {
+    std::size_t keyOffset = 0;
+    std::size_t keySize = 0;
+    std::string_view name;
+    TEnum value = {};
+};
+
+template<typename TEnum, std::size_t keyCount, std::size_t keyCharCount>
+struct EnumNameTable {
+    std::array<EnumNameEntry<TEnum>, keyCount> entries = {};
+    std::array<char, keyCharCount> keyChars = {};
+
+    constexpr std::string_view key(const EnumNameEntry<TEnum>& entry) const
+    {
+        return {keyChars.data() + entry.keyOffset, entry.keySize};
+    }
+};
+
+struct EnumNameTableSize {
+    std::size_t keyCount = 0;
+    std::size_t keyCharCount = 0;
+};
+
+template<typename TEnum>
+constexpr EnumNameTableSize enumNameTableSize()
+{
+    auto result = EnumNameTableSize{};
+    auto keyCharCounter = EnumKeyCharCounter{};
+    for (auto value = enumRangeMin<TEnum>(); value <= enumRangeMax<TEnum>(); ++value) {
+        const auto name = nameof::nameof_enum(static_cast<TEnum>(value));
+        if (name.empty())
+            continue;
+        for (auto keyFormatIndex = std::size_t{}; keyFormatIndex < enumKeyFormatCount; ++keyFormatIndex)
+            writeEnumKey(static_cast<EnumKeyFormat>(keyFormatIndex), name, keyCharCounter);
+        result.keyCount += enumKeyFormatCount;
+    }
+    result.keyCharCount = keyCharCounter.count;
+    return result;
+}
+
+template<typename TEnum>
+constexpr auto makeEnumNameTable()
+{
+    constexpr auto tableSize = enumNameTableSize<TEnum>();
+    auto table = EnumNameTable<TEnum, tableSize.keyCount, tableSize.keyCharCount>{};
+    auto entryIndex = std::size_t{};
+    auto keyCharWriter = EnumKeyCharWriter<tableSize.keyCharCount>{table.keyChars};
+    for (auto value = enumRangeMin<TEnum>(); value <= enumRangeMax<TEnum>(); ++value) {
+        const auto name = nameof::nameof_enum(static_cast<TEnum>(value));
+        if (name.empty())
+            continue;
+        for (auto keyFormatIndex = std::size_t{}; keyFormatIndex < enumKeyFormatCount; ++keyFormatIndex) {
+            auto& entry = table.entries[entryIndex++];
+            entry.keyOffset = keyCharWriter.index;
+            entry.name = name;
+            entry.value = static_cast<TEnum>(value);
+            writeEnumKey(static_cast<EnumKeyFormat>(keyFormatIndex), name, keyCharWriter);
+            entry.keySize = keyCharWriter.index - entry.keyOffset;
+        }
+    }
+
+    // std::sort isn't constexpr in C++17, the insertion sort is good enough for the enumerator lists
+    for (auto i = std::size_t{1}; i < table.entries.size(); ++i)
+        for (auto j = i; j > 0 && table.key(table.entries[j]) < table.key(table.entries[j - 1]); --j) {
+            const auto entry = table.entries[j];
+            table.entries[j] = table.entries[j - 1];
+            table.entries[j - 1] = entry;
+        }
+    return table;
+}
+
+template<typename TEnum>
+inline constexpr auto enumNameTable = makeEnumNameTable<TEnum>();
+
+template<typename TEnum>
+std::optional<TEnum> enumFromString(std::string_view name)
+{
+    const auto& table = enumNameTable<TEnum>;
+    const auto matchBegin = std::lower_bound(
+            table.entries.begin(),
+            table.entries.end(),
+            name,
+            [&](const EnumNameEntry<TEnum>& entry, std::string_view searchedName)
+            {
+                return table.key(entry) < searchedName;
+            });
+    auto matchEnd = matchBegin;
+    while (matchEnd != table.entries.end() && table.key(*matchEnd) == name)
+        ++matchEnd;
+    if (matchBegin == matchEnd)
+        return std::nullopt;
+
+    const auto isUnique = std::all_of(
+            matchBegin,
+            matchEnd,
+            [&](const EnumNameEntry<TEnum>& entry)
+            {
+                return entry.value == matchBegin->value;
+            });
+    if (isUnique)
+        return matchBegin->value;
+    // renderings of the names of different enumerators can be the same, like "fooBar" for Foo_Bar and FooBar, so
+    // such enumerators can only be read by their exact names
+    for (auto it = matchBegin; it != matchEnd; ++it)
+        if (it->name == name)
+            return it->value;
+    return std::nullopt;
+}
+
+template<typename TEnum>
+std::string_view enumToString(TEnum value)
+{
+    return nameof::nameof_enum(value);
+}
+
+#endif
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_ENUMCONVERTER_H
@@ -0,0 +1,109 @@
+#ifndef FIGCONE_ENVIRONMENTMAPPING_H
+#define FIGCONE_ENVIRONMENTMAPPING_H
+
+#include "nameutils.h"
+#include "parampathindex.h"
+#include "paramtreebuilder.h"
+#include "schema.h"
+#include "external/eel/string_utils.h"
+#include <figcone/nameformat.h>
+#include <figcone_tree/tree.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef _WIN32
+#include <stdlib.h>
+#else
+extern char** environ;
+#endif
+
+namespace figcone::detail {
+
+inline std::string environmentVariableName(std::string_view fieldName)
+{
+    auto result = toSnakeCase(fieldName);
+    for (auto& ch : result)
+        ch = eel::toupper(ch);
+    return result;
+}
+
+// Variable names don't depend on the name format, it only sets the names of the nodes and parameters in the created tree
+template<typename TCfg, NameFormat nameFormat>
+const ParamPathIndex& environmentMapping()
+{
+    static const auto mapping =
+            ParamPathIndex{configSchema<TCfg, NameFormat::Original>(), nameFormat, &environmentVariableName, "__"};
+    return mapping;
+}
+
+template<typename TCfg>
+const ParamPathIndex& environmentMapping(NameFormat nameFormat)
+{
+    switch (nameFormat) {
+    case NameFormat::SnakeCase:
+        return environmentMapping<TCfg, NameFormat::SnakeCase>();
+    case NameFormat::CamelCase:
+        return environmentMapping<TCfg, NameFormat::CamelCase>();
+    case NameFormat::KebabCase:
+        return environmentMapping<TCfg, NameFormat::KebabCase>();
+    default:
+        return environmentMapping<TCfg, NameFormat::Original>();
+    }
+}
+
+inline const char* const* processEnvironment()
+{
+#ifdef _WIN32
+    return _environ;
+#else
+    return environ;
+#endif
+}
+
+inline std::vector<std::string> splitEnvironmentVariableList(std::string_view value)
+{
+    auto result = std::vector<std::string>{};
+    if (value.empty())
+        return result;
+
+    auto pos = std::size_t{};
+    while (true) {
+        auto delimiterPos = value.find(',', pos);
+        result.emplace_back(value.substr(pos, delimiterPos - pos));
+        if (delimiterPos == std::string_view::npos)
+            return result;
+        pos = delimiterPos + 1;
+    }
+}
+
+inline Tree readEnvironment(
+        const ParamPathIndex& mapping,
+        std::string_view variablePrefix,
+        const char* const* environment)
+{
+    auto treeBuilder = ParamTreeBuilder{};
+    for (auto variable = environment; variable && *variable; ++variable) {
+        auto entry = std::string_view{*variable};
+        if (entry.substr(0, variablePrefix.size()) != variablePrefix)
+            continue;
+        auto valuePos = entry.find('=');
+        if (valuePos == std::string_view::npos)
+            continue;
+
+        auto target = mapping.find(entry.substr(variablePrefix.size(), valuePos - variablePrefix.size()));
+        if (!target)
+            continue;
+
+        auto value = entry.substr(valuePos + 1);
+        if (target->isParamList)
+            treeBuilder.setParamList(target->nodePath, target->paramName, splitEnvironmentVariableList(value));
+        else
+            treeBuilder.setParam(target->nodePath, target->paramName, std::string{value});
+    }
+    return treeBuilder.makeTree();
+}
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_ENVIRONMENTMAPPING_H
@@ -0,0 +1,48 @@
+#ifndef FIGCONE_EXCEPTIONS_H
+#define FIGCONE_EXCEPTIONS_H
+
+#include <cstdlib>
+#include <optional>
+#include <string>
+#include <utility>
+
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#define FIGCONE_EXCEPTIONS_ENABLED 1
+#else
+#define FIGCONE_EXCEPTIONS_ENABLED 0
+#endif
+
+namespace figcone::detail {
+
+template<typename TError>
+[[noreturn]] void throwError(TError&& error)
+{
+#if FIGCONE_EXCEPTIONS_ENABLED
+    throw std::forward<TError>(error);
+#else
+    static_cast<void>(error);
+    std::abort();
+#endif
+}
+
+// Calls user provided code (validators, post-processors, unregistered field handlers) which can only report
+// errors by throwing exceptions. Returns the message of the caught exception.
+template<typename TException, typename TFunc>
+std::optional<std::string> catchErrorMessage(const TFunc& func)
+{
+#if FIGCONE_EXCEPTIONS_ENABLED
+    try {
+        func();
+    }
+    catch (const TException& e) {
+        return e.what();
+    }
+#else
+    func();
+#endif
+    return std::nullopt;
+}
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_EXCEPTIONS_H
@@ -0,0 +1,34 @@
+#ifndef FIGCONE_FIELDKIND_H
+#define FIGCONE_FIELDKIND_H
+
+#include "stringconverter.h"
+#include "utils.h"
+#include "external/eel/type_traits.h"
+#include <figcone/fieldschema.h>
+
+namespace figcone::detail {
+
+template<typename TField>
+constexpr FieldKind fieldKind()
+{
+    using TValue = eel::remove_optional_t<TField>;
+    // figcone::optional wraps runtime reflection nodes in InitializedOptional
+    if constexpr (is_initialized_optional_v<TField>)
+        return FieldKind::Node;
+    else if constexpr (canBeReadAsParam<TField>())
+        return FieldKind::Param;
+    else if constexpr (eel::is_associative_container_v<TValue>)
+        return FieldKind::Dict;
+    else if constexpr (eel::is_dynamic_sequence_container_v<TValue>) {
+        if constexpr (canBeReadAsParam<typename TValue::value_type>())
+            return FieldKind::ParamList;
+        else
+            return FieldKind::NodeList;
+    }
+    else
+        return FieldKind::Node;
+}
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_FIELDKIND_H
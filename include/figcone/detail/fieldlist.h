@@ -0,0 +1,28 @@
+#ifndef FIGCONE_FIELDLIST_H
+#define FIGCONE_FIELDLIST_H
+
+namespace figcone::detail {
+
+// Fields of the runtime reflection configs are listed at compile time by the FIGCONE_* macros. Every macro declares
+// an overload of the figconeFields friend function that takes FieldRank of the field number and returns FieldList
+// with the member pointers of the preceding fields and of the declared field. The overload of the last field is selected
+// by calling figconeFields with FieldRank<maxFieldCount>, as the conversion to the most derived FieldRank is the best.
+inline constexpr auto maxFieldCount = 256;
+
+template<int rank>
+struct FieldRank : FieldRank<rank - 1> {};
+
+template<>
+struct FieldRank<0> {};
+
+template<auto... members>
+struct FieldList {
+    static constexpr auto size = sizeof...(members);
+};
+
+template<auto member, auto... members>
+FieldList<members..., member> appendField(FieldList<members...>);
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_FIELDLIST_H
@@ -0,0 +1,68 @@
+#ifndef FIGCONE_FIELDREGISTRY_H
+#define FIGCONE_FIELDREGISTRY_H
+
+#include "configreaderaccess.h"
+#include "configreaderptr.h"
+#include "exceptions.h"
+#include "fieldlist.h"
+#include "registeredfield.h"
+#include <figcone/errors.h>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace figcone::detail {
+
+template<typename TCfg>
+using RegisteredFieldList = decltype(figconeFields(FieldRank<maxFieldCount>{}, std::declval<const TCfg&>()));
+
+template<typename TMember>
+struct member_field;
+
+template<typename T, typename TCfg>
+struct member_field<T TCfg::*> {
+    using type = T;
+};
+
+template<auto member>
+using member_field_t = typename member_field<decltype(member)>::type;
+
+// Fields of a runtime reflection config are collected by creating the config once, in the same order as the fields of
+// the compile time list
+template<typename TCfg, typename TConfigReader = ConfigReader>
+const std::vector<RegisteredField>& registeredFields()
+{
+    static const auto fields = []
+    {
+        auto cfgReader = TConfigReader{};
+        auto result = ConfigReaderAccess{&cfgReader}.template collectRegisteredFields<TCfg>();
+        if (result.size() != RegisteredFieldList<TCfg>::size)
+            throwError(Error{
+                    "Fields of runtime reflection configs must be declared with FIGCONE_* macros to be used in "
+                    "fingerprint(), equal(), footprint(), constraints and the config schema"});
+        return result;
+    }();
+    return fields;
+}
+
+template<typename TCfg, typename TVisitor, auto... members>
+bool visitRegisteredFields(FieldList<members...>, TVisitor& visitor)
+{
+    const auto& fields = registeredFields<TCfg>();
+    auto index = std::size_t{};
+    return (visitor(std::integral_constant<decltype(members), members>{}, fields[index++].name) && ...);
+}
+
+// Calls the visitor with the member pointer constant and the name of every field of a runtime reflection config, until
+// it returns false. Returns false if the visiting was stopped.
+template<typename TCfg, typename TVisitor>
+bool visitRegisteredFields(TVisitor&& visitor)
+{
+    return visitRegisteredFields<TCfg>(RegisteredFieldList<TCfg>{}, visitor);
+}
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_FIELDREGISTRY_H
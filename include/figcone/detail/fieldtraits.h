@@ -1,7 +1,11 @@
 #ifndef FIGCONE_FIELDTRAITS_H
 #define FIGCONE_FIELDTRAITS_H
+#include "external/pfr.hpp"
 #include "external/eel/type_list.h"
+#include <cstddef>
+#include <memory>
 #include <type_traits>
+#include <utility>
 
 namespace figcone {
 
@@ -58,6 +62,9 @@ struct IsValidatedField : std::false_type {};
 template<typename T>
 struct IsValidatedField<T, std::void_t<typename T::validator>> : std::true_type {};
 
+template<typename T>
+using IsValidatedFieldTrait = IsValidatedField<T>;
+
 template<typename T, typename = void>
 struct HasFieldTraits : std::false_type {};
 
@@ -67,21 +74,31 @@ struct HasFieldTraits<T, std::void_t<typename T::traits>> : std::true_type {};
 template<typename T>
 constexpr auto hasFieldTraits = HasFieldTraits<T>::value;
 
-template<template<typename> typename TTraitChecker, typename TTrait, typename TCfg, typename TFieldValue>
-bool isTraitAndMatchesField(const TTrait&, TCfg& cfg, TFieldValue& field)
+// Declared only to take addresses of its fields in constant expressions, so it's never defined
+template<typename TCfg>
+extern const TCfg fieldTraitsObject;
+
+template<typename TCfg, std::size_t fieldIndex, auto fieldPtr>
+constexpr bool isFieldAtIndex()
+{
+    static_assert(
+            IsMemberPtr<fieldPtr, TCfg>::value,
+            "Field trait is invalid as it contains a pointer to a member of a different config structure.");
+    const auto& traitField = fieldTraitsObject<TCfg>.*fieldPtr;
+    const auto& field = pfr::get<fieldIndex>(fieldTraitsObject<TCfg>);
+    if constexpr (std::is_same_v<decltype(traitField), decltype(field)>)
+        return std::addressof(traitField) == std::addressof(field);
+    else
+        return false;
+}
+
+template<template<typename> typename TTraitChecker, typename TTrait, typename TCfg, std::size_t fieldIndex>
+constexpr bool isTraitOfField()
 {
-    if constexpr (!TTraitChecker<typename TTrait::type>::value)
+    if constexpr (!TTraitChecker<TTrait>::value)
         return false;
-    else {
-        static_assert(
-                IsMemberPtr<typename TTrait::type{}.fieldPtr, TCfg>::value,
-                "Field trait is invalid as it contains a pointer to a member of a different config structure.");
-        auto& traitField = cfg.*(typename TTrait::type{}.fieldPtr);
-        if constexpr (std::is_same_v<decltype(traitField), decltype(field)>)
-            return std::addressof(traitField) == std::addressof(field);
-        else
-            return false;
-    }
+    else
+        return isFieldAtIndex<TCfg, fieldIndex, TTrait::fieldPtr>();
 }
 
 template<
@@ -89,64 +106,62 @@ template<
         typename TTraitChecker,
         typename TTraitList,
         typename TCfg,
-        typename TFieldValue,
+        std::size_t fieldIndex,
         std::size_t... indices>
-bool hasMatchingTrait(TCfg& cfg, TFieldValue& field, std::index_sequence<indices...>)
+constexpr bool hasMatchingTrait(std::index_sequence<indices...>)
 {
-    return (isTraitAndMatchesField<TTraitChecker>(eel::get<indices>(TTraitList{}), cfg, field) || ...);
+    return (isTraitOfField<
+                    TTraitChecker,
+                    typename decltype(eel::get<indices>(TTraitList{}))::type,
+                    TCfg,
+                    fieldIndex>() ||
+            ...);
 }
 
-template<typename TCfg, typename TFieldValue>
-bool isOptionalField(TCfg& cfg, TFieldValue& field)
+// Field traits are matched with the config fields by their pfr indices at compile time, so the matching has no runtime
+// cost when a config is read
+template<template<typename> typename TTraitChecker, typename TCfg, std::size_t fieldIndex>
+constexpr bool hasFieldTrait()
 {
     if constexpr (detail::hasFieldTraits<TCfg>)
-        return hasMatchingTrait<IsOptionalFieldTrait, typename TCfg::traits>(
-                cfg,
-                field,
+        return hasMatchingTrait<TTraitChecker, typename TCfg::traits, TCfg, fieldIndex>(
                 std::make_index_sequence<TCfg::traits::size()>());
     else
         return false;
 }
 
-template<typename TCfg, typename TFieldValue>
-bool isCopyNodeListField(TCfg& cfg, TFieldValue& field)
+template<typename TCfg, std::size_t fieldIndex>
+constexpr bool isOptionalField()
 {
-    if constexpr (detail::hasFieldTraits<TCfg>)
-        return hasMatchingTrait<IsCopyNodeListFieldTrait, typename TCfg::traits>(
-                cfg,
-                field,
-                std::make_index_sequence<TCfg::traits::size()>());
-    else
-        return false;
+    return hasFieldTrait<IsOptionalFieldTrait, TCfg, fieldIndex>();
+}
+
+template<typename TCfg, std::size_t fieldIndex>
+constexpr bool isCopyNodeListField()
+{
+    return hasFieldTrait<IsCopyNodeListFieldTrait, TCfg, fieldIndex>();
 }
 
-template<typename TTrait, typename TCfg, typename TFieldValue, typename TFieldCreator>
-void setValidatorIfTraitMatchesField(const TTrait&, TCfg& cfg, TFieldValue& field, TFieldCreator& fieldCreator)
+template<typename TTrait, typename TCfg, std::size_t fieldIndex, typename TFieldCreator>
+void setValidatorIfTraitMatchesField(TFieldCreator& fieldCreator)
 {
-    if constexpr (IsValidatedField<typename TTrait::type>::value) {
-        static_assert(
-                IsMemberPtr<typename TTrait::type{}.fieldPtr, TCfg>::value,
-                "Field trait is invalid as it contains a pointer to a member of a different config structure.");
-        auto& traitField = cfg.*(typename TTrait::type{}.fieldPtr);
-        if constexpr (std::is_same_v<decltype(traitField), decltype(field)>)
-            if (std::addressof(traitField) == std::addressof(field))
-                fieldCreator.template ensure<typename TTrait::type::validator>();
-    }
+    if constexpr (isTraitOfField<IsValidatedFieldTrait, TTrait, TCfg, fieldIndex>())
+        fieldCreator.template ensure<typename TTrait::validator>();
 }
 
-template<typename TTraitList, typename TCfg, typename TFieldValue, typename TFieldCreator, std::size_t... indices>
-void setValidatorFromTraits(TCfg& cfg, TFieldValue& field, TFieldCreator& fieldCreator, std::index_sequence<indices...>)
+template<typename TTraitList, typename TCfg, std::size_t fieldIndex, typename TFieldCreator, std::size_t... indices>
+void setValidatorFromTraits(TFieldCreator& fieldCreator, std::index_sequence<indices...>)
 {
-    (setValidatorIfTraitMatchesField(eel::get<indices>(TTraitList{}), cfg, field, fieldCreator), ...);
+    (setValidatorIfTraitMatchesField<typename decltype(eel::get<indices>(TTraitList{}))::type, TCfg, fieldIndex>(
+             fieldCreator),
+     ...);
 }
 
-template<typename TCfg, typename TFieldValue, typename TFieldCreator>
-void setFieldValidators(TCfg& cfg, TFieldValue& field, TFieldCreator& fieldCreator)
+template<typename TCfg, std::size_t fieldIndex, typename TFieldCreator>
+void setFieldValidators(TFieldCreator& fieldCreator)
 {
     if constexpr (detail::hasFieldTraits<TCfg>)
-        setValidatorFromTraits<typename TCfg::traits>(
-                cfg,
-                field,
+        setValidatorFromTraits<typename TCfg::traits, TCfg, fieldIndex>(
                 fieldCreator,
                 std::make_index_sequence<TCfg::traits::size()>());
 }
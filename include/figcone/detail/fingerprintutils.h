@@ -0,0 +1,260 @@
+#ifndef FIGCONE_FINGERPRINTUTILS_H
+#define FIGCONE_FINGERPRINTUTILS_H
+
+#include "fieldregistry.h"
+#include "hasher.h"
+#include "stringconverter.h"
+#include "utils.h"
+#include "external/eel/type_traits.h"
+#include "external/pfr.hpp"
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace figcone {
+class Config;
+}
+
+namespace figcone::detail {
+
+template<typename T, typename = void>
+struct is_equality_comparable : std::false_type {};
+
+template<typename T>
+struct is_equality_comparable<T, std::void_t<decltype(std::declval<const T&>() == std::declval<const T&>())>>
+    : std::true_type {};
+
+template<typename T, typename = void>
+struct is_unordered_container : std::false_type {};
+
+template<typename T>
+struct is_unordered_container<T, std::void_t<typename T::hasher>> : std::true_type {};
+
+template<typename T>
+constexpr bool canBeWrittenToString()
+{
+    return std::is_convertible_v<const T&, std::string_view> || std::is_convertible_v<const T&, std::string> ||
+            is_string_streamable_v<T>;
+}
+
+template<typename T>
+std::string leafValueToString(const T& value)
+{
+    static_assert(
+            canBeWrittenToString<T>(),
+            "Config parameter type must be writable to std::ostream to be used in fingerprint() or equal()");
+    if constexpr (std::is_convertible_v<const T&, std::string_view>)
+        return std::string{std::string_view{value}};
+    else if constexpr (std::is_convertible_v<const T&, std::string>)
+        return value;
+    else if constexpr (is_string_streamable_v<T>) {
+        auto stream = std::stringstream{};
+        stream << value;
+        return stream.str();
+    }
+}
+
+template<typename T>
+void hashLeafValue(Hasher& hasher, const T& value)
+{
+    if constexpr (std::is_same_v<T, bool>)
+        hasher.add(static_cast<std::uint64_t>(value));
+    else if constexpr (std::is_integral_v<T>)
+        hasher.add(static_cast<std::uint64_t>(value));
+    else if constexpr (std::is_enum_v<T>)
+        hasher.add(static_cast<std::uint64_t>(static_cast<std::underlying_type_t<T>>(value)));
+    else if constexpr (std::is_floating_point_v<T>) {
+        // -0.0 and 0.0 are equal, so they must have the same hash
+        const auto normalizedValue = value == T{} ? 0.0 : static_cast<double>(value);
+        auto bits = std::uint64_t{};
+        std::memcpy(&bits, &normalizedValue, sizeof(bits));
+        hasher.add(bits);
+    }
+    else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+        hasher.add(std::string_view{value});
+    else
+        hasher.add(leafValueToString(value));
+}
+
+template<typename T>
+bool equalLeafValues(const T& lhs, const T& rhs)
+{
+    if constexpr (is_equality_comparable<T>::value)
+        return static_cast<bool>(lhs == rhs);
+    else
+        return leafValueToString(lhs) == leafValueToString(rhs);
+}
+
+template<typename T>
+bool equalValues(const T& lhs, const T& rhs);
+
+template<typename TCfg, std::size_t... indices>
+void hashStructure(Hasher& hasher, const TCfg& cfg, std::index_sequence<indices...>)
+{
+    (hashValue(hasher, pfr::get<indices>(cfg)), ...);
+}
+
+template<typename TCfg, std::size_t... indices>
+bool equalStructures(const TCfg& lhs, const TCfg& rhs, std::index_sequence<indices...>)
+{
+    return (equalValues(pfr::get<indices>(lhs), pfr::get<indices>(rhs)) && ...);
+}
+
+template<typename T>
+void hashValue(Hasher& hasher, const T& value)
+{
+    if constexpr (eel::is_optional_v<T> || is_initialized_optional_v<T>) {
+        hasher.add(static_cast<std::uint64_t>(value.has_value()));
+        if (value.has_value())
+            hashValue(hasher, *value);
+    }
+    else if constexpr (std::is_base_of_v<figcone::Config, T>)
+        visitRegisteredFields<T>(
+                [&](auto member, const std::string&)
+                {
+                    hashValue(hasher, value.*member());
+                    return true;
+                });
+    else if constexpr (canBeReadAsParam<T>())
+        hashLeafValue(hasher, value);
+    else if constexpr (eel::is_associative_container_v<T>) {
+        hasher.add(static_cast<std::uint64_t>(value.size()));
+        if constexpr (is_unordered_container<T>::value) {
+            // element order of unordered containers isn't stable, so element hashes are combined commutatively
+            auto elementsHash = std::uint64_t{};
+            for (const auto& [key, element] : value) {
+                auto elementHasher = Hasher{};
+                hashValue(elementHasher, key);
+                hashValue(elementHasher, element);
+                elementsHash += elementHasher.result();
+            }
+            hasher.add(elementsHash);
+        }
+        else
+            for (const auto& [key, element] : value) {
+                hashValue(hasher, key);
+                hashValue(hasher, element);
+            }
+    }
+    else if constexpr (eel::is_dynamic_sequence_container_v<T>) {
+        hasher.add(static_cast<std::uint64_t>(value.size()));
+        for (const auto& element : value)
+            hashValue(hasher, static_cast<const typename T::value_type&>(element));
+    }
+    else {
+        static_assert(
+                std::is_aggregate_v<T>,
+                "Config structure must be an aggregate or inherit from figcone::Config");
+        hashStructure(hasher, value, std::make_index_sequence<pfr::tuple_size_v<T>>{});
+    }
+}
+
+template<typename T>
+bool equalValues(const T& lhs, const T& rhs)
+{
+    if constexpr (eel::is_optional_v<T> || is_initialized_optional_v<T>) {
+        if (lhs.has_value() != rhs.has_value())
+            return false;
+        return !lhs.has_value() || equalValues(*lhs, *rhs);
+    }
+    else if constexpr (std::is_base_of_v<figcone::Config, T>)
+        return visitRegisteredFields<T>(
+                [&](auto member, const std::string&)
+                {
+                    return equalValues(lhs.*member(), rhs.*member());
+                });
+    else if constexpr (canBeReadAsParam<T>())
+        return equalLeafValues(lhs, rhs);
+    else if constexpr (eel::is_associative_container_v<T>) {
+        if (lhs.size() != rhs.size())
+            return false;
+        for (const auto& [key, element] : lhs) {
+            auto it = rhs.find(key);
+            if (it == rhs.end() || !equalValues(element, it->second))
+                return false;
+        }
+        return true;
+    }
+    else if constexpr (eel::is_dynamic_sequence_container_v<T>) {
+        if (lhs.size() != rhs.size())
+            return false;
+        auto rhsIt = rhs.begin();
+        for (auto lhsIt = lhs.begin(); lhsIt != lhs.end(); ++lhsIt, ++rhsIt)
+            if (!equalValues(
+                        static_cast<const typename T::value_type&>(*lhsIt),
+                        static_cast<const typename T::value_type&>(*rhsIt)))
+                return false;
+        return true;
+    }
+    else {
+        static_assert(
+                std::is_aggregate_v<T>,
+                "Config structure must be an aggregate or inherit from figcone::Config");
+        return equalStructures(lhs, rhs, std::make_index_sequence<pfr::tuple_size_v<T>>{});
+    }
+}
+
+template<typename TCfg, std::size_t... indices>
+bool hashStructureFieldPath(
+        Hasher& hasher,
+        const TCfg& cfg,
+        const std::vector<std::string>& path,
+        std::size_t pathIndex,
+        std::index_sequence<indices...>)
+{
+    return ((pfr::get_name<indices, TCfg>() == path[pathIndex] &&
+             hashFieldPath(hasher, pfr::get<indices>(cfg), path, pathIndex + 1)) ||
+            ...);
+}
+
+// Hashes the value of a field specified by the path of member names starting from the pathIndex element.
+// Elements of node lists are traversed with the rest of the path. Returns false if the path doesn't exist.
+template<typename T>
+bool hashFieldPath(Hasher& hasher, const T& value, const std::vector<std::string>& path, std::size_t pathIndex)
+{
+    if (pathIndex == path.size()) {
+        hashValue(hasher, value);
+        return true;
+    }
+
+    if constexpr (eel::is_optional_v<T> || is_initialized_optional_v<T>) {
+        hasher.add(static_cast<std::uint64_t>(value.has_value()));
+        return !value.has_value() || hashFieldPath(hasher, *value, path, pathIndex);
+    }
+    else if constexpr (std::is_base_of_v<figcone::Config, T>) {
+        auto isFound = false;
+        visitRegisteredFields<T>(
+                [&](auto member, const std::string& name)
+                {
+                    if (name != path[pathIndex])
+                        return true;
+                    isFound = hashFieldPath(hasher, value.*member(), path, pathIndex + 1);
+                    return false;
+                });
+        return isFound;
+    }
+    else if constexpr (canBeReadAsParam<T>() || eel::is_associative_container_v<T>)
+        return false;
+    else if constexpr (eel::is_dynamic_sequence_container_v<T>) {
+        hasher.add(static_cast<std::uint64_t>(value.size()));
+        for (const auto& element : value)
+            if (!hashFieldPath(hasher, static_cast<const typename T::value_type&>(element), path, pathIndex))
+                return false;
+        return true;
+    }
+    else {
+        static_assert(
+                std::is_aggregate_v<T>,
+                "Config structure must be an aggregate or inherit from figcone::Config");
+        return hashStructureFieldPath(hasher, value, path, pathIndex, std::make_index_sequence<pfr::tuple_size_v<T>>{});
+    }
+}
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_FINGERPRINTUTILS_H
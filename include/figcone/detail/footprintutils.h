@@ -0,0 +1,200 @@
+#ifndef FIGCONE_FOOTPRINTUTILS_H
+#define FIGCONE_FOOTPRINTUTILS_H
+
+#include "fieldregistry.h"
+#include "heapfootprint.h"
+#include "stringconverter.h"
+#include "utils.h"
+#include "external/eel/type_traits.h"
+#include "external/pfr.hpp"
+#include <figcone/fieldfootprint.h>
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace figcone {
+class Config;
+}
+
+namespace figcone::detail {
+
+class FootprintCollector {
+public:
+    void add(const std::string& path, std::size_t size, const HeapFootprint& heapFootprint)
+    {
+        auto [it, inserted] = fieldIndices_.emplace(path, fields_.size());
+        if (inserted)
+            fields_.push_back({path});
+        auto& field = fields_[it->second];
+        field.size += size;
+        field.heapBytes += heapFootprint.heapBytes;
+        field.unusedCapacityBytes += heapFootprint.unusedCapacityBytes;
+        field.hasWastedCapacity = field.hasWastedCapacity || heapFootprint.hasWastedCapacity;
+    }
+
+    std::vector<FieldFootprint> result() &&
+    {
+        std::stable_sort(
+                fields_.begin(),
+                fields_.end(),
+                [](const FieldFootprint& lhs, const FieldFootprint& rhs)
+                {
+                    return lhs.size + lhs.heapBytes > rhs.size + rhs.heapBytes;
+                });
+        return std::move(fields_);
+    }
+
+private:
+    std::vector<FieldFootprint> fields_;
+    std::map<std::string, std::size_t> fieldIndices_;
+};
+
+template<typename T, typename = void>
+struct has_capacity : std::false_type {};
+
+template<typename T>
+struct has_capacity<T, std::void_t<decltype(std::declval<const T&>().capacity())>> : std::true_type {};
+
+template<typename T, typename = void>
+struct has_bucket_count : std::false_type {};
+
+template<typename T>
+struct has_bucket_count<T, std::void_t<decltype(std::declval<const T&>().bucket_count())>> : std::true_type {};
+
+template<typename T, typename = void>
+struct has_traits_type : std::false_type {};
+
+template<typename T>
+struct has_traits_type<T, std::void_t<typename T::traits_type>> : std::true_type {};
+
+template<typename T>
+HeapFootprint heapFootprint(FootprintCollector& collector, const T& value, const std::string& path);
+
+template<typename T>
+HeapFootprint fieldFootprint(FootprintCollector& collector, const T& value, const std::string& path)
+{
+    const auto result = heapFootprint(collector, value, path);
+    collector.add(path, sizeof(T), result);
+    return result;
+}
+
+inline void addHeapFootprint(HeapFootprint& result, const HeapFootprint& nestedFootprint)
+{
+    result.heapBytes += nestedFootprint.heapBytes;
+    result.unusedCapacityBytes += nestedFootprint.unusedCapacityBytes;
+}
+
+// Contiguous containers own a single buffer of capacity() elements, unless their contents fit in the storage of the
+// container object itself, like short strings do
+template<typename T>
+HeapFootprint bufferFootprint(const T& value)
+{
+    using ValueType = typename T::value_type;
+    const auto inlineCapacity = T{}.capacity();
+    if (value.capacity() <= inlineCapacity)
+        return {};
+
+    // strings allocate an additional element for the null terminator
+    const auto terminatorSize = has_traits_type<T>::value ? 1 : 0;
+    const auto unusedCapacity = value.capacity() - value.size();
+    return {(value.capacity() + terminatorSize) * sizeof(ValueType),
+            unusedCapacity * sizeof(ValueType),
+            value.capacity() > 2 * value.size()};
+}
+
+// Node based containers allocate every element separately. Node sizes are estimated with the usual pointer overhead of
+// the standard library implementations.
+template<typename T>
+HeapFootprint nodesFootprint(const T& value)
+{
+    using ValueType = typename T::value_type;
+    if constexpr (has_bucket_count<T>::value) {
+        constexpr auto nodeSize = sizeof(ValueType) + sizeof(void*) + sizeof(std::size_t);
+        return {value.size() * nodeSize + value.bucket_count() * sizeof(void*), 0, false};
+    }
+    else if constexpr (eel::is_associative_container_v<T>) {
+        constexpr auto nodeSize = sizeof(ValueType) + 4 * sizeof(void*);
+        return {value.size() * nodeSize, 0, false};
+    }
+    else {
+        constexpr auto nodeSize = sizeof(ValueType) + 2 * sizeof(void*);
+        return {value.size() * nodeSize, 0, false};
+    }
+}
+
+template<typename TCfg, std::size_t... indices>
+HeapFootprint structureFootprint(
+        FootprintCollector& collector,
+        const TCfg& cfg,
+        const std::string& path,
+        std::index_sequence<indices...>)
+{
+    auto result = HeapFootprint{};
+    (addHeapFootprint(
+             result,
+             fieldFootprint(
+                     collector,
+                     pfr::get<indices>(cfg),
+                     joinFieldPath(path, std::string{pfr::get_name<indices, TCfg>()}))),
+     ...);
+    return result;
+}
+
+// Returns the heap footprint of the value and adds the footprints of its nested config fields to the collector
+template<typename T>
+HeapFootprint heapFootprint(FootprintCollector& collector, const T& value, const std::string& path)
+{
+    if constexpr (eel::is_optional_v<T> || is_initialized_optional_v<T>) {
+        if (!value.has_value())
+            return {};
+        return heapFootprint(collector, *value, path);
+    }
+    else if constexpr (std::is_base_of_v<figcone::Config, T>) {
+        auto result = HeapFootprint{};
+        visitRegisteredFields<T>(
+                [&](auto member, const std::string& name)
+                {
+                    addHeapFootprint(result, fieldFootprint(collector, value.*member(), joinFieldPath(path, name)));
+                    return true;
+                });
+        return result;
+    }
+    else if constexpr (has_capacity<T>::value && canBeReadAsParam<T>())
+        return bufferFootprint(value);
+    else if constexpr (canBeReadAsParam<T>())
+        return {};
+    else if constexpr (eel::is_associative_container_v<T>) {
+        auto result = nodesFootprint(value);
+        for (const auto& [key, element] : value) {
+            addHeapFootprint(result, heapFootprint(collector, key, path));
+            addHeapFootprint(result, heapFootprint(collector, element, path));
+        }
+        return result;
+    }
+    else if constexpr (eel::is_dynamic_sequence_container_v<T>) {
+        auto result = HeapFootprint{};
+        if constexpr (has_capacity<T>::value)
+            result = bufferFootprint(value);
+        else
+            result = nodesFootprint(value);
+        for (const auto& element : value)
+            addHeapFootprint(
+                    result,
+                    heapFootprint(collector, static_cast<const typename T::value_type&>(element), path));
+        return result;
+    }
+    else {
+        static_assert(
+                std::is_aggregate_v<T>,
+                "Config structure must be an aggregate or inherit from figcone::Config");
+        return structureFootprint(collector, value, path, std::make_index_sequence<pfr::tuple_size_v<T>>{});
+    }
+}
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_FOOTPRINTUTILS_H
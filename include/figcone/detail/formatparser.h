@@ -0,0 +1,33 @@
+#ifndef FIGCONE_FORMATPARSER_H
+#define FIGCONE_FORMATPARSER_H
+
+#include "external/eel/type_traits.h"
+
+namespace figcone::detail {
+
+struct JsonFormat {};
+struct YamlFormat {};
+struct TomlFormat {};
+struct IniFormat {};
+struct XmlFormat {};
+struct ShoalFormat {};
+
+// Specialized in the format reader headers, so the parser of a format is required only by translation units that use
+// ConfigReader methods of this format
+template<typename TFormat, typename TCfg>
+struct FormatParser {
+    static_assert(
+            eel::dependent_false<TCfg>,
+            "Parser of the config format isn't available. Include the format reader header, like "
+            "<figcone/jsonreader.h>, and make sure that the format library is linked");
+};
+
+template<typename TFormat, typename TCfg>
+auto makeFormatParser()
+{
+    return typename FormatParser<TFormat, TCfg>::type{};
+}
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_FORMATPARSER_H
@@ -0,0 +1,76 @@
+#ifndef FIGCONE_HASHER_H
+#define FIGCONE_HASHER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace figcone::detail {
+
+// Simple 64-bit hash based on the xxHash64 round and avalanche functions.
+// Input bytes are read in the little-endian order on all platforms, so the result is stable between runs and builds.
+class Hasher {
+public:
+    void add(std::string_view data)
+    {
+        add(static_cast<std::uint64_t>(data.size()));
+        auto pos = std::size_t{};
+        for (; pos + 8 <= data.size(); pos += 8)
+            addWord(readWord(data.data() + pos, 8));
+        if (pos < data.size())
+            addWord(readWord(data.data() + pos, data.size() - pos));
+    }
+
+    void add(std::uint64_t value)
+    {
+        addWord(value);
+    }
+
+    std::uint64_t result() const
+    {
+        auto hash = state_ + length_ * prime5;
+        hash ^= hash >> 33;
+        hash *= prime2;
+        hash ^= hash >> 29;
+        hash *= prime3;
+        hash ^= hash >> 32;
+        return hash;
+    }
+
+private:
+    void addWord(std::uint64_t word)
+    {
+        auto lane = word * prime2;
+        lane = rotl(lane, 31);
+        lane *= prime1;
+        state_ ^= lane;
+        state_ = rotl(state_, 27) * prime1 + prime4;
+        ++length_;
+    }
+
+    static std::uint64_t readWord(const char* data, std::size_t size)
+    {
+        auto word = std::uint64_t{};
+        for (auto i = std::size_t{}; i < size; ++i)
+            word |= static_cast<std::uint64_t>(static_cast<unsigned char>(data[i])) << (8 * i);
+        return word;
+    }
+
+    static std::uint64_t rotl(std::uint64_t value, int shift)
+    {
+        return (value << shift) | (value >> (64 - shift));
+    }
+
+private:
+    static constexpr std::uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+    static constexpr std::uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+    static constexpr std::uint64_t prime3 = 0x165667B19E3779F9ULL;
+    static constexpr std::uint64_t prime4 = 0x85EBCA77C2B2AE63ULL;
+    static constexpr std::uint64_t prime5 = 0x27D4EB2F165667C5ULL;
+    std::uint64_t state_ = prime5;
+    std::uint64_t length_ = 0;
+};
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_HASHER_H
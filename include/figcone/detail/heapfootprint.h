@@ -0,0 +1,22 @@
+#ifndef FIGCONE_HEAPFOOTPRINT_H
+#define FIGCONE_HEAPFOOTPRINT_H
+
+#include <cstddef>
+#include <string>
+
+namespace figcone::detail {
+
+struct HeapFootprint {
+    std::size_t heapBytes = 0;
+    std::size_t unusedCapacityBytes = 0;
+    bool hasWastedCapacity = false;
+};
+
+inline std::string joinFieldPath(const std::string& path, const std::string& name)
+{
+    return path.empty() ? name : path + "." + name;
+}
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_HEAPFOOTPRINT_H
@@ -1,6 +1,7 @@
 #ifndef FIGCONE_INITIALIZEDOPTIONAL_H
 #define FIGCONE_INITIALIZEDOPTIONAL_H
 
+#include "exceptions.h"
 #include <optional>
 #include <stdexcept>
 #include <utility>
@@ -66,42 +67,42 @@ public:
     T* operator->()
     {
         if (!hasValue_)
-            throw std::bad_optional_access{};
+            throwError(std::bad_optional_access{});
         return &value_;
     }
 
     const T* operator->() const
     {
         if (!hasValue_)
-            throw std::bad_optional_access{};
+            throwError(std::bad_optional_access{});
         return &value_;
     }
 
     T& operator*()
     {
         if (!hasValue_)
-            throw std::bad_optional_access{};
+            throwError(std::bad_optional_access{});
         return value_;
     }
 
     const T& operator*() const
     {
         if (!hasValue_)
-            throw std::bad_optional_access{};
+            throwError(std::bad_optional_access{});
         return value_;
     }
 
     T& value()
     {
         if (!hasValue_)
-            throw std::bad_optional_access{};
+            throwError(std::bad_optional_access{});
         return value_;
     }
 
     const T& value() const
     {
         if (!hasValue_)
-            throw std::bad_optional_access{};
+            throwError(std::bad_optional_access{});
         return value_;
     }
 
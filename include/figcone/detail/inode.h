@@ -2,15 +2,18 @@
 #define FIGCONE_INODE_H
 
 #include "iconfigentity.h"
+#include <figcone/errors.h>
 #include <figcone_tree/tree.h>
 #include <memory>
+#include <optional>
 #include <string>
 
 namespace figcone::detail {
 
 class INode : public IConfigEntity {
 public:
-    virtual void load(const figcone::TreeNode& node) = 0;
+    // values of the node's params can be moved from the tree if it's discarded after loading
+    virtual std::optional<ConfigError> load(const figcone::TreeNode& node, bool canMoveTreeValues) = 0;
     virtual bool hasValue() const = 0;
 };
 
@@ -2,13 +2,16 @@
 #define FIGCONE_IPARAM_H
 
 #include "iconfigentity.h"
+#include <figcone/errors.h>
 #include <figcone_tree/tree.h>
+#include <optional>
 
 namespace figcone::detail {
 
 class IParam : public IConfigEntity {
 public:
-    virtual void load(const figcone::TreeParam& node) = 0;
+    // values of the param can be moved from the tree if it's discarded after loading
+    virtual std::optional<ConfigError> load(const figcone::TreeParam& node, bool canMoveTreeValues) = 0;
     virtual bool hasValue() const = 0;
 };
 
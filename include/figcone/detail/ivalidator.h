@@ -1,13 +1,19 @@
 #ifndef FIGCONE_IVALIDATOR_H
 #define FIGCONE_IVALIDATOR_H
 
+#include "iconfigentity.h"
 #include "external/eel/interface.h"
+#include <figcone/errors.h>
+#include <figcone_tree/streamposition.h>
+#include <optional>
 
 namespace figcone::detail {
 
 class IValidator : private eel::interface<IValidator> {
 public:
-    virtual void validate() = 0;
+    virtual std::optional<ConfigError> validate() = 0;
+    virtual StreamPosition position() = 0;
+    virtual const IConfigEntity& entity() const = 0;
 };
 
 } //namespace figcone::detail
@@ -0,0 +1,91 @@
+#ifndef FIGCONE_MEMORYRESOURCE_H
+#define FIGCONE_MEMORYRESOURCE_H
+
+#include "external/eel/type_traits.h"
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace figcone::detail {
+
+template<typename T>
+constexpr bool usesMemoryResource()
+{
+    if constexpr (eel::is_optional_v<T>)
+        return usesMemoryResource<eel::remove_optional_t<T>>();
+    else
+        return std::uses_allocator_v<T, std::pmr::polymorphic_allocator<std::byte>>;
+}
+
+// Creates a value with a polymorphic allocator using the memory resource, values of other types and values created
+// without a memory resource are constructed as usual
+template<typename T, typename... TArgs>
+T makeWithMemoryResource(std::pmr::memory_resource* memoryResource, TArgs&&... args)
+{
+    if constexpr (std::uses_allocator_v<T, std::pmr::polymorphic_allocator<std::byte>>) {
+        if (memoryResource) {
+            const auto allocator = std::pmr::polymorphic_allocator<std::byte>{memoryResource};
+            if constexpr (std::is_constructible_v<T, std::allocator_arg_t, decltype(allocator), TArgs...>)
+                return T(std::allocator_arg, allocator, std::forward<TArgs>(args)...);
+            else
+                return T(std::forward<TArgs>(args)..., allocator);
+        }
+    }
+    return T(std::forward<TArgs>(args)...);
+}
+
+// Returns the value moved to the memory resource, the elements of std::pmr containers are moved with it
+template<typename T>
+T withMemoryResource(T value, std::pmr::memory_resource* memoryResource)
+{
+    if constexpr (!usesMemoryResource<T>())
+        return value;
+    else if constexpr (eel::is_optional_v<T>) {
+        if (!value.has_value())
+            return value;
+        return T{withMemoryResource(std::move(*value), memoryResource)};
+    }
+    else
+        return makeWithMemoryResource<T>(memoryResource, std::move(value));
+}
+
+// Allocators of std::pmr containers aren't propagated on assignment, so the target is recreated in place to store the
+// value in the memory resource
+template<typename T>
+void setWithMemoryResource(T& target, T value, std::pmr::memory_resource* memoryResource)
+{
+    if constexpr (usesMemoryResource<T>()) {
+        if (memoryResource) {
+            auto result = withMemoryResource(std::move(value), memoryResource);
+            std::destroy_at(std::addressof(target));
+            ::new (static_cast<void*>(std::addressof(target))) T(std::move(result));
+            return;
+        }
+    }
+    target = std::move(value);
+}
+
+// Moves the current value of the config field, like a default value of a config structure member, to the memory
+// resource
+template<typename T>
+void bindMemoryResource(T& target, std::pmr::memory_resource* memoryResource)
+{
+    if constexpr (usesMemoryResource<T>())
+        if (memoryResource)
+            setWithMemoryResource(target, std::move(target), memoryResource);
+}
+
+// Resets the container field to an empty value placed in std::optional for optional fields
+template<typename T>
+void resetWithMemoryResource(T& target, std::pmr::memory_resource* memoryResource)
+{
+    using TValue = eel::remove_optional_t<T>;
+    setWithMemoryResource(target, T(makeWithMemoryResource<TValue>(memoryResource)), memoryResource);
+}
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_MEMORYRESOURCE_H
@@ -4,110 +4,127 @@
 #include "external/eel/string_utils.h"
 #include "external/eel/utility.h"
 #include <figcone/nameformat.h>
-#include <algorithm>
 #include <string>
+#include <string_view>
 
 namespace figcone::detail {
 
-inline std::string formatName(const std::string& name)
+// Names of config fields are C++ identifiers, so the character classification doesn't depend on the locale and is
+// available at compile time
+constexpr bool isNameAlpha(char ch)
+{
+    return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z');
+}
+
+constexpr bool isNameDigit(char ch)
+{
+    return ch >= '0' && ch <= '9';
+}
+
+constexpr bool isNameUpper(char ch)
+{
+    return ch >= 'A' && ch <= 'Z';
+}
+
+constexpr char toNameLower(char ch)
+{
+    return isNameUpper(ch) ? static_cast<char>(ch - 'A' + 'a') : ch;
+}
+
+constexpr char toNameUpper(char ch)
+{
+    return ch >= 'a' && ch <= 'z' ? static_cast<char>(ch - 'a' + 'A') : ch;
+}
+
+constexpr std::string_view trimName(std::string_view name)
 {
-    auto result = name;
     //remove front non-alphabet characters
-    result.erase(
-            result.begin(),
-            std::find_if(
-                    result.begin(),
-                    result.end(),
-                    [](auto ch)
-                    {
-                        return eel::isalpha(ch);
-                    }));
+    while (!name.empty() && !isNameAlpha(name.front()))
+        name.remove_prefix(1);
     //remove back non-alphabet and non-digit characters
-    result.erase(
-            std::find_if(
-                    result.rbegin(),
-                    result.rend(),
-                    [](auto ch)
-                    {
-                        return eel::isalnum(ch);
-                    })
-                    .base(),
-            result.end());
-    return result;
+    while (!name.empty() && !isNameAlpha(name.back()) && !isNameDigit(name.back()))
+        name.remove_suffix(1);
+    return name;
 }
 
-inline std::string toCamelCase(const std::string& name)
+template<typename TOutput>
+constexpr void writeCamelCaseName(std::string_view name, TOutput& output)
 {
-    auto result = std::string{};
     auto prevCharNonAlpha = false;
-    auto formattedName = formatName(name);
-    if (!formattedName.empty())
-        formattedName[0] = static_cast<char>(eel::tolower(formattedName[0]));
-    for (auto ch : formattedName) {
-        if (!eel::isalpha(ch)) {
-            if (eel::isdigit(ch))
-                result.push_back(ch);
-            if (!result.empty())
+    auto isOutputEmpty = true;
+    for (auto i = std::size_t{}; i < name.size(); ++i) {
+        auto ch = i == 0 ? toNameLower(name[i]) : name[i];
+        if (!isNameAlpha(ch)) {
+            if (isNameDigit(ch)) {
+                output.push_back(ch);
+                isOutputEmpty = false;
+            }
+            if (!isOutputEmpty)
                 prevCharNonAlpha = true;
             continue;
         }
         if (prevCharNonAlpha)
-            ch = static_cast<char>(eel::toupper(ch));
-        result.push_back(ch);
+            ch = toNameUpper(ch);
+        output.push_back(ch);
+        isOutputEmpty = false;
         prevCharNonAlpha = false;
     }
-    return result;
-}
-
-inline std::string toKebabCase(const std::string& name)
-{
-    auto result = std::string{};
-    auto formattedName = formatName(eel::replace(name, "_", "-"));
-    if (!formattedName.empty())
-        formattedName[0] = eel::tolower(formattedName[0]);
-    for (auto ch : formattedName) {
-        if (eel::isupper(ch) && !result.empty()) {
-            result.push_back('-');
-            result.push_back(eel::tolower(ch));
-        }
-        else
-            result.push_back(ch);
-    }
-    return result;
 }
 
-inline std::string toSnakeCase(const std::string& name)
+template<typename TOutput>
+constexpr void writeSeparatedName(std::string_view name, char separator, TOutput& output)
 {
-    auto result = std::string{};
-    auto formattedName = formatName(name);
-    if (!formattedName.empty())
-        formattedName[0] = eel::tolower(formattedName[0]);
-    for (auto ch : formattedName) {
-        if (eel::isupper(ch) && !result.empty()) {
-            result.push_back('_');
-            result.push_back(eel::tolower(ch));
+    for (auto i = std::size_t{}; i < name.size(); ++i) {
+        const auto ch = name[i];
+        if (i == 0)
+            output.push_back(toNameLower(ch));
+        else if (isNameUpper(ch)) {
+            output.push_back(separator);
+            output.push_back(toNameLower(ch));
         }
+        else if (ch == '_')
+            output.push_back(separator);
         else
-            result.push_back(ch);
+            output.push_back(ch);
     }
-    return result;
 }
 
-inline std::string convertName(NameFormat nameFormat, const std::string& configName)
+// Writes the name converted to the name format with TOutput::push_back(char), so the conversion can be performed at
+// compile time with a fixed size buffer
+template<typename TOutput>
+constexpr void writeConvertedName(NameFormat nameFormat, std::string_view name, TOutput& output)
 {
+    const auto trimmedName = trimName(name);
     switch (nameFormat) {
     case NameFormat::Original:
-        return formatName(configName);
+        for (auto ch : trimmedName)
+            output.push_back(ch);
+        return;
     case NameFormat::SnakeCase:
-        return toSnakeCase(configName);
+        writeSeparatedName(trimmedName, '_', output);
+        return;
     case NameFormat::CamelCase:
-        return toCamelCase(configName);
+        writeCamelCaseName(trimmedName, output);
+        return;
     case NameFormat::KebabCase:
-        return toKebabCase(configName);
+        writeSeparatedName(trimmedName, '-', output);
+        return;
     }
     eel::unreachable();
 }
 
+inline std::string convertName(NameFormat nameFormat, std::string_view configName)
+{
+    auto result = std::string{};
+    writeConvertedName(nameFormat, configName, result);
+    return result;
+}
+
+inline std::string toSnakeCase(std::string_view name)
+{
+    return convertName(NameFormat::SnakeCase, name);
+}
+
 } //namespace figcone::detail
 
-#endif //FIGCONE_NAMEUTILS_H
\ No newline at end of file
+#endif //FIGCONE_NAMEUTILS_H
@@ -4,11 +4,13 @@
 #include "configreaderaccess.h"
 #include "iconfigentity.h"
 #include "inode.h"
+#include "readobservation.h"
 #include "utils.h"
 #include "external/eel/type_traits.h"
 #include <figcone/errors.h>
 #include <figcone_tree/tree.h>
 #include <algorithm>
+#include <optional>
 #include <sstream>
 #include <string>
 
@@ -34,12 +36,19 @@ public:
     }
 
 private:
-    void load(const TreeNode& node) override
+    std::optional<ConfigError> load(const TreeNode& node, bool) override
     {
+        auto readObserver = cfgReader_ ? ConfigReaderAccess{cfgReader_}.readObserver() : nullptr;
+        auto observedPhase = ObservedReadPhase{
+                readObserver,
+                ReadPhase::Node,
+                name_,
+                0,
+                readObserver ? treeNodeElementCount(node) : 0};
         hasValue_ = true;
         position_ = node.position();
         if (!node.isItem())
-            throw ConfigError{"Node '" + name_ + "': config node can't be a list.", node.position()};
+            return ConfigError{"Node '" + name_ + "': config node can't be a list.", node.position()};
 
         if constexpr (is_initialized_optional_v<TCfg> || eel::is_optional_v<TCfg>)
             cfg_.emplace();
@@ -49,7 +58,8 @@ private:
         }
 
         if (cfgReader_)
-            ConfigReaderAccess{cfgReader_}.template load<TCfg>(node);
+            ConfigReaderAccess{cfgReader_}.template load<TCfg>(node, "Node '" + name_ + "': ");
+        return std::nullopt;
     }
 
     bool hasValue() const override
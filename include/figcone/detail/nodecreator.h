@@ -76,21 +76,30 @@ public:
         return TCfg{nestedCfgReader_};
     }
 
-    NodeCreator& ensure(std::function<void(const eel::remove_optional_t<TCfg>&)> validatingFunc)
+    template<typename TValidatingFunc>
+    NodeCreator& ensure(TValidatingFunc&& validatingFunc)
     {
-        if (cfgReader_)
-            ConfigReaderAccess{cfgReader_}.addValidator(
-                    std::make_unique<Validator<TCfg>>(*node_, nodeCfg_, std::move(validatingFunc)));
+        addValidator(std::forward<TValidatingFunc>(validatingFunc));
         return *this;
     }
 
     template<typename TValidator, typename... TArgs>
     NodeCreator& ensure(TArgs&&... args)
+    {
+        addValidator(TValidator{std::forward<TArgs>(args)...});
+        return *this;
+    }
+
+private:
+    template<typename TValidatingFunc>
+    void addValidator(TValidatingFunc&& validatingFunc)
     {
         if (cfgReader_)
             ConfigReaderAccess{cfgReader_}.addValidator(
-                    std::make_unique<Validator<TCfg>>(*node_, nodeCfg_, TValidator{std::forward<TArgs>(args)...}));
-        return *this;
+                    std::make_unique<Validator<TCfg, std::decay_t<TValidatingFunc>>>(
+                            *node_,
+                            nodeCfg_,
+                            std::forward<TValidatingFunc>(validatingFunc)));
     }
 
 private:
@@ -3,12 +3,17 @@
 
 #include "configreaderaccess.h"
 #include "inode.h"
-#include "loadingerror.h"
+#include "memoryresource.h"
+#include "readobservation.h"
 #include "utils.h"
 #include "external/eel/type_traits.h"
 #include <figcone/errors.h>
 #include <figcone_tree/tree.h>
+#include <deque>
+#include <list>
 #include <memory>
+#include <optional>
+#include <string>
 #include <type_traits>
 #include <vector>
 
@@ -23,6 +28,29 @@ enum class NodeListType {
     Copy
 };
 
+template<typename TList>
+struct has_stable_elements : std::bool_constant<is_reservable_v<TList>> {};
+
+template<typename T, typename TAllocator>
+struct has_stable_elements<std::deque<T, TAllocator>> : std::true_type {};
+
+template<typename T, typename TAllocator>
+struct has_stable_elements<std::list<T, TAllocator>> : std::true_type {};
+
+// Elements are loaded in place if their references stay valid while the list grows, which is true for the reserved
+// vectors, deques and lists, and if they can be constructed with emplace_back. Aggregates with the figcone::Config base
+// can be constructed this way only in C++20.
+template<typename TCfgList>
+constexpr bool canLoadNodeListElementsInPlace()
+{
+    using List = eel::remove_optional_t<TCfgList>;
+    using Cfg = typename List::value_type;
+    if constexpr (std::is_base_of_v<figcone::Config, Cfg>)
+        return has_stable_elements<List>::value && std::is_constructible_v<Cfg, ConfigReaderPtr>;
+    else
+        return has_stable_elements<List>::value;
+}
+
 template<typename TCfgList>
 class NodeList : public detail::INode {
 public:
@@ -42,52 +70,80 @@ public:
         hasValue_ = true;
     }
 
-    void load(const TreeNode& nodeList) override
+    std::optional<ConfigError> load(const TreeNode& nodeList, bool) override
     {
+        auto readObserver = cfgReader_ ? ConfigReaderAccess{cfgReader_}.readObserver() : nullptr;
+        auto observedPhase = ObservedReadPhase{
+                readObserver,
+                ReadPhase::NodeList,
+                name_,
+                0,
+                readObserver ? treeNodeListElementCount(nodeList) : 0};
+        auto memoryResource = cfgReader_ ? ConfigReaderAccess{cfgReader_}.memoryResource() : nullptr;
         hasValue_ = true;
         position_ = nodeList.position();
-        nodeList_ = TCfgList{};
+        resetWithMemoryResource(nodeList_, memoryResource);
         if (!nodeList.isList())
-            throw ConfigError{"Node list '" + name_ + "': config node must be a list.", nodeList.position()};
-        if constexpr (eel::is_optional<TCfgList>::value)
-            nodeList_.emplace();
+            return ConfigError{"Node list '" + name_ + "': config node must be a list.", nodeList.position()};
 
+        const auto errorMsgPrefix = "Node list '" + name_ + "': ";
         maybeOptValue(nodeList_).clear();
+        // move constructors of figcone::Config subclasses can throw, so their elements are copied on reallocation and
+        // lose the memory resource of the list
+        if constexpr (is_reservable_v<eel::remove_optional_t<TCfgList>>)
+            maybeOptValue(nodeList_).reserve(nodeList.asList().size());
         for (auto i = 0; i < nodeList.asList().size(); ++i) {
-            const auto& treeNode = nodeList.asList().at(i);
-            try {
-                using Cfg = typename eel::remove_optional_t<TCfgList>::value_type;
-                if constexpr (std::is_base_of_v<figcone::Config, Cfg>) {
-                    if constexpr (!std::is_aggregate_v<Cfg>)
-                        static_assert(
-                                std::is_constructible_v<Cfg, detail::ConfigReaderPtr>,
-                                "Non aggregate config objects must inherit figcone::Config constructors with 'using "
-                                "Config::Config;'");
-
+            if (cfgReader_ && ConfigReaderAccess{cfgReader_}.isLoadingStopped())
+                break;
+            // each element registers its own fields in the reader
+            if (cfgReader_)
+                ConfigReaderAccess{cfgReader_}.clearNodeListElement();
+
+            const auto elementIndex = readObserver ? std::to_string(i) : std::string{};
+            auto observedElementPhase = ObservedReadPhase{
+                    readObserver,
+                    ReadPhase::NodeListElement,
+                    elementIndex,
+                    0,
+                    readObserver ? treeNodeElementCount(nodeList.asList().at(i)) : 0};
+
+            using Cfg = typename eel::remove_optional_t<TCfgList>::value_type;
+            if constexpr (std::is_base_of_v<figcone::Config, Cfg>) {
+                if constexpr (!std::is_aggregate_v<Cfg>)
+                    static_assert(
+                            std::is_constructible_v<Cfg, detail::ConfigReaderPtr>,
+                            "Non aggregate config objects must inherit figcone::Config constructors with 'using "
+                            "Config::Config;'");
+
+                if constexpr (canLoadNodeListElementsInPlace<TCfgList>()) {
+                    auto& cfg = maybeOptValue(nodeList_).emplace_back(cfgReader_);
+                    loadElement<Cfg>(nodeList, i, errorMsgPrefix);
+                    if (cfgReader_)
+                        ConfigReaderAccess{cfgReader_}.resetConfigReader(cfg);
+                }
+                else {
                     auto cfg = Cfg{cfgReader_};
-                    if (cfgReader_) {
-                        if (type_ == NodeListType::Copy && i > 0)
-                            ConfigReaderAccess{cfgReader_}.template load<Cfg>(nodeList.asList().at(0));
-                        ConfigReaderAccess{cfgReader_}.template load<Cfg>(treeNode);
-                    }
+                    loadElement<Cfg>(nodeList, i, errorMsgPrefix);
                     maybeOptValue(nodeList_).emplace_back(std::move(cfg));
                 }
+            }
+            else {
+                if constexpr (canLoadNodeListElementsInPlace<TCfgList>()) {
+                    auto& cfg = maybeOptValue(nodeList_).emplace_back();
+                    if (cfgReader_)
+                        ConfigReaderAccess{cfgReader_}.template loadStructure<Cfg>(cfg);
+                    loadElement<Cfg>(nodeList, i, errorMsgPrefix);
+                }
                 else {
                     auto cfg = Cfg{};
-                    if (cfgReader_) {
+                    if (cfgReader_)
                         ConfigReaderAccess{cfgReader_}.template loadStructure<Cfg>(cfg);
-
-                        if (type_ == NodeListType::Copy && i > 0)
-                            ConfigReaderAccess{cfgReader_}.template load<Cfg>(nodeList.asList().at(0));
-                        ConfigReaderAccess{cfgReader_}.template load<Cfg>(treeNode);
-                    }
+                    loadElement<Cfg>(nodeList, i, errorMsgPrefix);
                     maybeOptValue(nodeList_).emplace_back(std::move(cfg));
                 }
             }
-            catch (const LoadingError& e) {
-                throw ConfigError{"Node list '" + name_ + "': " + e.what(), treeNode.position()};
-            }
         }
+        return std::nullopt;
     }
 
     bool hasValue() const override
@@ -108,6 +164,17 @@ public:
         return "Node list '" + name_ + "'";
     }
 
+private:
+    template<typename TCfg>
+    void loadElement(const TreeNode& nodeList, int index, const std::string& errorMsgPrefix)
+    {
+        if (!cfgReader_)
+            return;
+        if (type_ == NodeListType::Copy && index > 0)
+            ConfigReaderAccess{cfgReader_}.template load<TCfg>(nodeList.asList().at(0), errorMsgPrefix);
+        ConfigReaderAccess{cfgReader_}.template load<TCfg>(nodeList.asList().at(index), errorMsgPrefix);
+    }
+
 private:
     std::string name_;
     TCfgList& nodeList_;
@@ -3,6 +3,7 @@
 
 #include "configreaderaccess.h"
 #include "creatormode.h"
+#include "memoryresource.h"
 #include "nodelist.h"
 #include "external/eel/contract.h"
 #include "external/eel/type_traits.h"
@@ -44,7 +45,11 @@ public:
         , nodeList_{std::make_unique<NodeList<TCfgList>>(
                   nodeListName_,
                   nodeList,
-                  cfgReader_ ? ConfigReaderAccess{cfgReader_}.makeNestedReader(nodeListName_) : ConfigReaderPtr{},
+                  cfgReader_ ? ConfigReaderAccess{cfgReader_}.makeNestedNodeListReader(
+                                       nodeListName_,
+                                       type == NodeListType::Copy,
+                                       canLoadNodeListElementsInPlace<TCfgList>())
+                             : ConfigReaderPtr{},
                   type)}
         , nodeListValue_(nodeList)
     {
@@ -67,28 +72,36 @@ public:
     operator TCfgList()
     {
         createNodeList();
-        return {};
+        return makeWithMemoryResource<TCfgList>(
+                cfgReader_ ? ConfigReaderAccess{cfgReader_}.memoryResource() : nullptr);
     }
 
-    NodeListCreator& ensure(std::function<void(const eel::remove_optional_t<TCfgList>&)> validatingFunc)
+    template<typename TValidatingFunc>
+    NodeListCreator& ensure(TValidatingFunc&& validatingFunc)
     {
-        if (cfgReader_)
-            ConfigReaderAccess{cfgReader_}.addValidator(
-                    std::make_unique<Validator<TCfgList>>(*nodeList_, nodeListValue_, std::move(validatingFunc)));
+        addValidator(std::forward<TValidatingFunc>(validatingFunc));
         return *this;
     }
 
     template<typename TValidator, typename... TArgs>
     NodeListCreator& ensure(TArgs&&... args)
     {
-        if (cfgReader_)
-            ConfigReaderAccess{cfgReader_}.addValidator(std::make_unique<Validator<TCfgList>>(
-                    *nodeList_,
-                    nodeListValue_,
-                    TValidator{std::forward<TArgs>(args)...}));
+        addValidator(TValidator{std::forward<TArgs>(args)...});
         return *this;
     }
 
+private:
+    template<typename TValidatingFunc>
+    void addValidator(TValidatingFunc&& validatingFunc)
+    {
+        if (cfgReader_)
+            ConfigReaderAccess{cfgReader_}.addValidator(
+                    std::make_unique<Validator<TCfgList, std::decay_t<TValidatingFunc>>>(
+                            *nodeList_,
+                            nodeListValue_,
+                            std::forward<TValidatingFunc>(validatingFunc)));
+    }
+
 private:
     ConfigReaderPtr cfgReader_;
     std::string nodeListName_;
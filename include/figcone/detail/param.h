@@ -3,25 +3,30 @@
 
 #include "iconfigentity.h"
 #include "iparam.h"
+#include "memoryresource.h"
 #include "stringconverter.h"
+#include "treevalue.h"
 #include "utils.h"
-#include "external/eel/functional.h"
 #include "external/eel/type_traits.h"
 #include <figcone/errors.h>
 #include <figcone_tree/stringconverter.h>
 #include <figcone_tree/tree.h>
 #include <algorithm>
+#include <memory_resource>
+#include <optional>
 #include <sstream>
 #include <string>
+#include <variant>
 
 namespace figcone::detail {
 
 template<typename T>
 class Param : public IParam {
 public:
-    Param(std::string name, T& paramValue)
+    Param(std::string name, T& paramValue, std::pmr::memory_resource* memoryResource = nullptr)
         : name_{std::move(name)}
         , paramValue_{paramValue}
+        , memoryResource_{memoryResource}
     {
     }
 
@@ -31,27 +36,27 @@ public:
     }
 
 private:
-    void load(const TreeParam& param) override
+    std::optional<ConfigError> load(const TreeParam& param, bool canMoveTreeValues) override
     {
         hasValue_ = true;
         position_ = param.position();
         if (!param.isItem())
-            throw ConfigError{"Parameter '" + name_ + "': config parameter can't be a list.", param.position()};
+            return ConfigError{"Parameter '" + name_ + "': config parameter can't be a list.", param.position()};
+        if constexpr (canBeMovedFromTree<T>()) {
+            if (canMoveTreeValues) {
+                setWithMemoryResource(paramValue_, T{takeTreeValue(param.value())}, memoryResource_);
+                return std::nullopt;
+            }
+        }
         auto paramReadResult = convertFromString<T>(param.value());
-        auto readResultVisitor = eel::overloaded{
-                [&](const T& param)
-                {
-                    paramValue_ = param;
-                },
-                [&](const StringConversionError& error)
-                {
-                    throw ConfigError{
-                            "Couldn't set parameter '" + name_ + "' value from '" + param.value() + "'" +
-                                    (!error.message.empty() ? ": " + error.message : ""),
-                            param.position()};
-                }};
+        if (auto error = std::get_if<StringConversionError>(&paramReadResult))
+            return ConfigError{
+                    "Couldn't set parameter '" + name_ + "' value from '" + param.value() + "'" +
+                            (!error->message.empty() ? ": " + error->message : ""),
+                    param.position()};
 
-        std::visit(readResultVisitor, paramReadResult);
+        setWithMemoryResource(paramValue_, std::move(std::get<T>(paramReadResult)), memoryResource_);
+        return std::nullopt;
     }
 
     bool hasValue() const override
@@ -75,6 +80,7 @@ private:
 private:
     std::string name_;
     T& paramValue_;
+    std::pmr::memory_resource* memoryResource_;
     bool hasValue_ = false;
     StreamPosition position_;
 };
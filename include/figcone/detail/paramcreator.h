@@ -2,9 +2,11 @@
 #define FIGCONE_PARAMCREATOR_H
 
 #include "configreaderaccess.h"
+#include "memoryresource.h"
 #include "param.h"
 #include "validator.h"
 #include "external/eel/contract.h"
+#include <memory_resource>
 
 namespace figcone::detail {
 
@@ -13,9 +15,10 @@ class ParamCreator {
 public:
     ParamCreator(ConfigReaderPtr cfgReader, std::string paramName, T& paramValue, bool isOptional = false)
         : cfgReader_{cfgReader}
+        , memoryResource_{cfgReader_ ? ConfigReaderAccess{cfgReader_}.memoryResource() : nullptr}
         , paramName_{(eel::precondition(!paramName.empty(), FIGCONE_EEL_LINE), std::move(paramName))}
         , paramValue_{paramValue}
-        , param_{std::make_unique<Param<T>>(paramName_, paramValue)}
+        , param_{std::make_unique<Param<T>>(paramName_, paramValue, memoryResource_)}
     {
         if (isOptional)
             param_->markValueIsSet();
@@ -28,20 +31,17 @@ public:
         return *this;
     }
 
-    ParamCreator<T>& ensure(std::function<void(const eel::remove_optional_t<T>&)> validatingFunc)
+    template<typename TValidatingFunc>
+    ParamCreator<T>& ensure(TValidatingFunc&& validatingFunc)
     {
-        if (cfgReader_)
-            ConfigReaderAccess{cfgReader_}.addValidator(
-                    std::make_unique<Validator<T>>(*param_, paramValue_, std::move(validatingFunc)));
+        addValidator(std::forward<TValidatingFunc>(validatingFunc));
         return *this;
     }
 
     template<typename TValidator, typename... TArgs>
     ParamCreator<T>& ensure(TArgs&&... args)
     {
-        if (cfgReader_)
-            ConfigReaderAccess{cfgReader_}.addValidator(
-                    std::make_unique<Validator<T>>(*param_, paramValue_, TValidator{std::forward<TArgs>(args)...}));
+        addValidator(TValidator{std::forward<TArgs>(args)...});
         return *this;
     }
 
@@ -54,11 +54,24 @@ public:
     operator T()
     {
         createParam();
-        return defaultValue_;
+        return withMemoryResource(defaultValue_, memoryResource_);
+    }
+
+private:
+    template<typename TValidatingFunc>
+    void addValidator(TValidatingFunc&& validatingFunc)
+    {
+        if (cfgReader_)
+            ConfigReaderAccess{cfgReader_}.addValidator(
+                    std::make_unique<Validator<T, std::decay_t<TValidatingFunc>>>(
+                            *param_,
+                            paramValue_,
+                            std::forward<TValidatingFunc>(validatingFunc)));
     }
 
 private:
     ConfigReaderPtr cfgReader_;
+    std::pmr::memory_resource* memoryResource_;
     std::string paramName_;
     T& paramValue_;
     std::unique_ptr<Param<T>> param_;
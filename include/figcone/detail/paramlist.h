@@ -2,15 +2,21 @@
 #define FIGCONE_PARAMLIST_H
 
 #include "iparam.h"
+#include "memoryresource.h"
 #include "stringconverter.h"
+#include "treevalue.h"
 #include "utils.h"
 #include "external/eel/type_traits.h"
 #include <figcone/errors.h>
 #include <figcone_tree/stringconverter.h>
 #include <figcone_tree/tree.h>
 #include <algorithm>
+#include <memory_resource>
+#include <optional>
 #include <sstream>
 #include <string>
+#include <type_traits>
+#include <variant>
 #include <vector>
 
 namespace figcone::detail {
@@ -22,9 +28,10 @@ class ParamList : public IParam {
             "Param list field must be a sequence container or a sequence container placed in std::optional");
 
 public:
-    ParamList(std::string name, TParamList& paramValue)
+    ParamList(std::string name, TParamList& paramValue, std::pmr::memory_resource* memoryResource = nullptr)
         : name_{std::move(name)}
         , paramListValue_{paramValue}
+        , memoryResource_{memoryResource}
     {
     }
 
@@ -34,34 +41,47 @@ public:
     }
 
 private:
-    void load(const TreeParam& paramList) override
+    std::optional<ConfigError> load(const TreeParam& paramList, bool canMoveTreeValues) override
     {
+        using ParamListValue = eel::remove_optional_t<TParamList>;
+        using Param = typename ParamListValue::value_type;
         position_ = paramList.position();
         hasValue_ = true;
-        paramListValue_ = TParamList{};
-        if constexpr (eel::is_optional_v<TParamList>)
-            paramListValue_.emplace();
+        resetWithMemoryResource(paramListValue_, memoryResource_);
 
         if (!paramList.isList())
-            throw ConfigError{"Parameter list '" + name_ + "': config parameter must be a list.", paramList.position()};
+            return ConfigError{
+                    "Parameter list '" + name_ + "': config parameter must be a list.",
+                    paramList.position()};
+        // the list of the tree is taken as a whole when the field has the same type
+        if constexpr (canBeMovedFromTree<Param>() && std::is_same_v<ParamListValue, std::vector<std::string>>) {
+            if (canMoveTreeValues) {
+                maybeOptValue(paramListValue_) = takeTreeValue(paramList.valueList());
+                return std::nullopt;
+            }
+        }
+
+        // lists of numbers can have millions of elements, so the storage is allocated once
+        if constexpr (is_reservable_v<ParamListValue>)
+            maybeOptValue(paramListValue_).reserve(paramList.valueList().size());
         for (const auto& paramValueStr : paramList.valueList()) {
-            using Param = typename eel::remove_optional_t<TParamList>::value_type;
+            if constexpr (canBeMovedFromTree<Param>()) {
+                if (canMoveTreeValues) {
+                    maybeOptValue(paramListValue_).emplace_back(takeTreeValue(paramValueStr));
+                    continue;
+                }
+            }
             auto paramReadResult = convertFromString<Param>(paramValueStr);
-            auto readResultVisitor = eel::overloaded{
-                    [&](const Param& param)
-                    {
-                        maybeOptValue(paramListValue_).emplace_back(param);
-                    },
-                    [&](const StringConversionError& error)
-                    {
-                        throw ConfigError{
-                                "Couldn't set parameter list element'" + name_ + "' value from '" + paramValueStr +
-                                        "'" + (!error.message.empty() ? ": " + error.message : ""),
-                                paramList.position()};
-                    }};
+            if (auto error = std::get_if<StringConversionError>(&paramReadResult))
+                return ConfigError{
+                        "Couldn't set parameter list element'" + name_ + "' value from '" + paramValueStr + "'" +
+                                (!error->message.empty() ? ": " + error->message : ""),
+                        paramList.position()};
 
-            std::visit(readResultVisitor, paramReadResult);
+            maybeOptValue(paramListValue_)
+                    .emplace_back(withMemoryResource(std::move(std::get<Param>(paramReadResult)), memoryResource_));
         }
+        return std::nullopt;
     }
 
     bool hasValue() const override
@@ -85,6 +105,7 @@ private:
 private:
     std::string name_;
     TParamList& paramListValue_;
+    std::pmr::memory_resource* memoryResource_;
     bool hasValue_ = false;
     StreamPosition position_;
 };
@@ -3,11 +3,13 @@
 
 #include "configreaderaccess.h"
 #include "inode.h"
+#include "memoryresource.h"
 #include "paramlist.h"
 #include "utils.h"
 #include "validator.h"
 #include "external/eel/contract.h"
 #include "external/eel/type_traits.h"
+#include <memory_resource>
 #include <vector>
 
 namespace figcone::detail {
@@ -25,9 +27,13 @@ public:
             TParamList& paramListValue,
             bool isOptional = false)
         : cfgReader_{cfgReader}
+        , memoryResource_{cfgReader_ ? ConfigReaderAccess{cfgReader_}.memoryResource() : nullptr}
         , paramListName_{(eel::precondition(!paramListName.empty(), FIGCONE_EEL_LINE), std::move(paramListName))}
         , paramListValue_{paramListValue}
-        , paramList_{std::make_unique<ParamList<TParamList>>(paramListName_, paramListValue)}
+        , paramList_{std::make_unique<ParamList<TParamList>>(
+                  paramListName_,
+                  paramListValue,
+                  memoryResource_)}
     {
         if (isOptional)
             paramList_->markValueIsSet();
@@ -40,22 +46,17 @@ public:
         return *this;
     }
 
-    ParamListCreator<TParamList>& ensure(std::function<void(const eel::remove_optional_t<TParamList>&)> validatingFunc)
+    template<typename TValidatingFunc>
+    ParamListCreator<TParamList>& ensure(TValidatingFunc&& validatingFunc)
     {
-        if (cfgReader_)
-            ConfigReaderAccess{cfgReader_}.addValidator(
-                    std::make_unique<Validator<TParamList>>(*paramList_, paramListValue_, std::move(validatingFunc)));
+        addValidator(std::forward<TValidatingFunc>(validatingFunc));
         return *this;
     }
 
     template<typename TValidator, typename... TArgs>
     ParamListCreator<TParamList>& ensure(TArgs&&... args)
     {
-        if (cfgReader_)
-            ConfigReaderAccess{cfgReader_}.addValidator(std::make_unique<Validator<TParamList>>(
-                    *paramList_,
-                    paramListValue_,
-                    TValidator{std::forward<TArgs>(args)...}));
+        addValidator(TValidator{std::forward<TArgs>(args)...});
         return *this;
     }
 
@@ -68,11 +69,24 @@ public:
     operator TParamList()
     {
         createParamList();
-        return defaultValue_;
+        return withMemoryResource(defaultValue_, memoryResource_);
+    }
+
+private:
+    template<typename TValidatingFunc>
+    void addValidator(TValidatingFunc&& validatingFunc)
+    {
+        if (cfgReader_)
+            ConfigReaderAccess{cfgReader_}.addValidator(
+                    std::make_unique<Validator<TParamList, std::decay_t<TValidatingFunc>>>(
+                            *paramList_,
+                            paramListValue_,
+                            std::forward<TValidatingFunc>(validatingFunc)));
     }
 
 private:
     ConfigReaderPtr cfgReader_;
+    std::pmr::memory_resource* memoryResource_;
     std::string paramListName_;
     TParamList& paramListValue_;
     std::unique_ptr<ParamList<TParamList>> paramList_;
@@ -0,0 +1,88 @@
+#ifndef FIGCONE_PARAMPATHINDEX_H
+#define FIGCONE_PARAMPATHINDEX_H
+
+#include "nameutils.h"
+#include <figcone/fieldschema.h>
+#include <figcone/nameformat.h>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace figcone::detail {
+
+struct ParamPathTarget {
+    std::vector<std::string> nodePath;
+    std::string paramName;
+    bool isParamList;
+};
+
+// Maps the full names of config parameters (e.g. DB__POOL_SIZE or db.pool-size) to their location in the config tree.
+// The node and parameter names of the tree are formatted with nameFormat, the segments of the full names are created
+// from the original field names with pathSegmentName.
+class ParamPathIndex {
+public:
+    using PathSegmentNameFunc = std::string (*)(std::string_view fieldName);
+
+    ParamPathIndex(
+            ConfigSchema schema,
+            NameFormat nameFormat,
+            PathSegmentNameFunc pathSegmentName,
+            std::string pathSeparator)
+        : nameFormat_{nameFormat}
+        , pathSegmentName_{pathSegmentName}
+        , pathSeparator_{std::move(pathSeparator)}
+    {
+        addFields(schema, {}, {});
+    }
+
+    const ParamPathTarget* find(std::string_view paramPath) const
+    {
+        auto it = targets_.find(paramPath);
+        if (it == targets_.end())
+            return nullptr;
+        return &it->second;
+    }
+
+private:
+    void addFields(
+            ConfigSchema schema,
+            const std::string& pathPrefix,
+            const std::vector<std::string>& nodePath)
+    {
+        for (const auto& field : schema) {
+            auto path = pathPrefix + pathSegmentName_(field.name);
+            switch (field.kind) {
+            case FieldKind::Param:
+            case FieldKind::ParamList:
+                targets_.emplace(
+                        std::move(path),
+                        ParamPathTarget{
+                                nodePath,
+                                convertName(nameFormat_, field.name),
+                                field.kind == FieldKind::ParamList});
+                break;
+            case FieldKind::Node: {
+                auto nestedNodePath = nodePath;
+                nestedNodePath.emplace_back(convertName(nameFormat_, field.name));
+                addFields(field.nestedSchema(), path + pathSeparator_, nestedNodePath);
+                break;
+            }
+            case FieldKind::NodeList:
+            case FieldKind::Dict:
+                break;
+            }
+        }
+    }
+
+private:
+    NameFormat nameFormat_;
+    PathSegmentNameFunc pathSegmentName_;
+    std::string pathSeparator_;
+    std::map<std::string, ParamPathTarget, std::less<>> targets_;
+};
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_PARAMPATHINDEX_H
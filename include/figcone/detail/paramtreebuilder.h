@@ -0,0 +1,76 @@
+#ifndef FIGCONE_PARAMTREEBUILDER_H
+#define FIGCONE_PARAMTREEBUILDER_H
+
+#include <figcone_tree/tree.h>
+#include <map>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace figcone::detail {
+
+// Collects parameters from sources without a document structure (environment, command line) and creates
+// a config tree from them.
+class ParamTreeBuilder {
+public:
+    void setParam(const std::vector<std::string>& nodePath, const std::string& name, std::string value)
+    {
+        node(nodePath).params.insert_or_assign(name, std::move(value));
+    }
+
+    void setParamList(
+            const std::vector<std::string>& nodePath,
+            const std::string& name,
+            std::vector<std::string> values)
+    {
+        node(nodePath).params.insert_or_assign(name, std::move(values));
+    }
+
+    void addParamListValue(const std::vector<std::string>& nodePath, const std::string& name, std::string value)
+    {
+        auto& param = node(nodePath).params[name];
+        if (!std::holds_alternative<std::vector<std::string>>(param))
+            param = std::vector<std::string>{};
+        std::get<std::vector<std::string>>(param).emplace_back(std::move(value));
+    }
+
+    Tree makeTree() const
+    {
+        auto root = makeTreeRoot();
+        addNode(*root, root_);
+        return Tree{std::move(root)};
+    }
+
+private:
+    struct Node {
+        std::map<std::string, std::variant<std::string, std::vector<std::string>>> params;
+        std::map<std::string, Node> nodes;
+    };
+
+    Node& node(const std::vector<std::string>& nodePath)
+    {
+        auto result = &root_;
+        for (const auto& nodeName : nodePath)
+            result = &result->nodes[nodeName];
+        return *result;
+    }
+
+    static void addNode(TreeNode& treeNode, const Node& node)
+    {
+        for (const auto& [paramName, param] : node.params) {
+            if (auto paramList = std::get_if<std::vector<std::string>>(&param))
+                treeNode.asItem().addParamList(paramName, *paramList, {});
+            else
+                treeNode.asItem().addParam(paramName, std::get<std::string>(param), {});
+        }
+        for (const auto& [nodeName, nestedNode] : node.nodes)
+            addNode(treeNode.asItem().addNode(nodeName, {}), nestedNode);
+    }
+
+private:
+    Node root_;
+};
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_PARAMTREEBUILDER_H
@@ -0,0 +1,30 @@
+#ifndef FIGCONE_PARSE_H
+#define FIGCONE_PARSE_H
+
+#include "exceptions.h"
+#include <figcone/errors.h>
+#include <figcone/expected.h>
+#include <figcone_tree/iparser.h>
+#include <figcone_tree/tree.h>
+#include <istream>
+
+namespace figcone::detail {
+
+// Parsers of the figcone_tree interface report errors by throwing exceptions
+inline Expected<Tree, ConfigError> tryParse(IParser& parser, std::istream& configStream)
+{
+#if FIGCONE_EXCEPTIONS_ENABLED
+    try {
+        return parser.parse(configStream);
+    }
+    catch (const Error& e) {
+        return Unexpected{ConfigError{e.what()}};
+    }
+#else
+    return parser.parse(configStream);
+#endif
+}
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_PARSE_H
@@ -0,0 +1,73 @@
+#ifndef FIGCONE_READOBSERVATION_H
+#define FIGCONE_READOBSERVATION_H
+
+#include <figcone/readobserver.h>
+#include <figcone_tree/tree.h>
+#include <cstddef>
+#include <istream>
+#include <string_view>
+
+namespace figcone::detail {
+
+// Reports the begin and end events of a read phase to the observer. Without an attached observer, it only checks
+// the observer pointer.
+class ObservedReadPhase {
+public:
+    ObservedReadPhase(
+            IReadObserver* observer,
+            ReadPhase phase,
+            std::string_view name = {},
+            std::size_t byteCount = 0,
+            std::size_t elementCount = 0)
+        : observer_{observer}
+        , phaseInfo_{phase, name, byteCount, elementCount}
+    {
+        if (observer_)
+            observer_->onPhaseBegin(phaseInfo_);
+    }
+
+    ~ObservedReadPhase()
+    {
+        if (observer_)
+            observer_->onPhaseEnd(phaseInfo_);
+    }
+
+    ObservedReadPhase(const ObservedReadPhase&) = delete;
+    ObservedReadPhase& operator=(const ObservedReadPhase&) = delete;
+
+private:
+    IReadObserver* observer_;
+    ReadPhaseInfo phaseInfo_;
+};
+
+inline std::size_t treeNodeElementCount(const TreeNode& node)
+{
+    if (!node.isItem())
+        return 0;
+    return node.asItem().paramNames().size() + node.asItem().nodeNames().size();
+}
+
+inline std::size_t treeNodeListElementCount(const TreeNode& node)
+{
+    if (!node.isList())
+        return 0;
+    return static_cast<std::size_t>(node.asList().size());
+}
+
+// Returns the number of bytes from the current position to the end of the stream, or 0 if the stream isn't seekable
+inline std::size_t remainingStreamSize(std::istream& stream)
+{
+    const auto position = stream.tellg();
+    if (position == std::istream::pos_type(-1))
+        return 0;
+    stream.seekg(0, std::ios_base::end);
+    const auto endPosition = stream.tellg();
+    stream.seekg(position);
+    if (endPosition == std::istream::pos_type(-1))
+        return 0;
+    return static_cast<std::size_t>(endPosition - position);
+}
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_READOBSERVATION_H
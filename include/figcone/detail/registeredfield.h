@@ -0,0 +1,16 @@
+#ifndef FIGCONE_REGISTEREDFIELD_H
+#define FIGCONE_REGISTEREDFIELD_H
+
+#include <string>
+
+namespace figcone::detail {
+
+// Field of a runtime reflection config registered by the FIGCONE_* macros when the config is created
+struct RegisteredField {
+    std::string name;
+    bool isCopyNodeList = false;
+};
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_REGISTEREDFIELD_H
@@ -0,0 +1,179 @@
+#ifndef FIGCONE_SCHEMA_H
+#define FIGCONE_SCHEMA_H
+
+#include "fieldkind.h"
+#include "fieldregistry.h"
+#include "fieldtraits.h"
+#include "nameutils.h"
+#include "stringconverter.h"
+#include "utils.h"
+#include "external/eel/type_traits.h"
+#include "external/pfr.hpp"
+#include <figcone/fieldschema.h>
+#include <figcone/nameformat.h>
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace figcone {
+class Config;
+}
+
+namespace figcone::detail {
+
+// Field names of the compile time schema are stored in buffers large enough for every name format
+template<std::size_t maxSize>
+struct FieldNameBuffer {
+    std::array<char, maxSize> chars = {};
+    std::size_t size = 0;
+
+    constexpr void push_back(char ch)
+    {
+        chars[size++] = ch;
+    }
+};
+
+template<typename TCfg, std::size_t index, NameFormat nameFormat>
+constexpr auto makeSchemaFieldName()
+{
+    constexpr auto name = pfr::get_name<index, TCfg>();
+    // the snake and kebab case formats insert a separator before every uppercase letter
+    auto result = FieldNameBuffer<name.size() * 2>{};
+    writeConvertedName(nameFormat, name, result);
+    return result;
+}
+
+template<typename TCfg, std::size_t index, NameFormat nameFormat>
+inline constexpr auto schemaFieldName = makeSchemaFieldName<TCfg, index, nameFormat>();
+
+template<typename TCfg, NameFormat nameFormat>
+constexpr ConfigSchema configSchema();
+
+template<typename TField, NameFormat nameFormat>
+constexpr auto nestedConfigSchemaFunc() -> ConfigSchema (*)()
+{
+    using TValue = eel::remove_optional_t<TField>;
+    constexpr auto kind = fieldKind<TField>();
+    if constexpr (kind == FieldKind::Node)
+        return &configSchema<TValue, nameFormat>;
+    else if constexpr (kind == FieldKind::NodeList)
+        return &configSchema<typename TValue::value_type, nameFormat>;
+    else
+        return nullptr;
+}
+
+template<typename T>
+constexpr FieldValueType fieldValueType()
+{
+    using TValue = eel::remove_optional_t<T>;
+    if constexpr (std::is_same_v<TValue, bool>)
+        return FieldValueType::Bool;
+    else if constexpr (std::is_integral_v<TValue>)
+        return FieldValueType::Integer;
+    else if constexpr (std::is_floating_point_v<TValue>)
+        return FieldValueType::Real;
+    else if constexpr (std::is_constructible_v<TValue, std::string>)
+        return FieldValueType::String;
+    else
+        return FieldValueType::Other;
+}
+
+template<typename TField>
+constexpr FieldValueType fieldElementValueType()
+{
+    using TValue = eel::remove_optional_t<TField>;
+    constexpr auto kind = fieldKind<TField>();
+    if constexpr (kind == FieldKind::Param)
+        return fieldValueType<TValue>();
+    else if constexpr (kind == FieldKind::Dict)
+        return fieldValueType<typename TValue::mapped_type>();
+    else if constexpr (kind == FieldKind::ParamList)
+        return fieldValueType<typename TValue::value_type>();
+    else
+        return FieldValueType::Other;
+}
+
+template<typename TField, NameFormat nameFormat>
+constexpr FieldSchema makeFieldSchema(std::string_view name, bool isOptionalField, bool isCopyNodeListField)
+{
+    return {name,
+            fieldKind<TField>(),
+            fieldElementValueType<TField>(),
+            isOptionalField || eel::is_optional_v<TField> || is_initialized_optional_v<TField>,
+            isCopyNodeListField,
+            nestedConfigSchemaFunc<TField, nameFormat>()};
+}
+
+template<typename TCfg, std::size_t index, NameFormat nameFormat>
+constexpr FieldSchema makeStructureFieldSchema()
+{
+    constexpr const auto& name = schemaFieldName<TCfg, index, nameFormat>;
+    return makeFieldSchema<pfr::tuple_element_t<index, TCfg>, nameFormat>(
+            std::string_view{name.chars.data(), name.size},
+            isOptionalField<TCfg, index>(),
+            isCopyNodeListField<TCfg, index>());
+}
+
+template<typename TCfg, NameFormat nameFormat, std::size_t... indices>
+constexpr auto makeConfigSchemaFields(std::index_sequence<indices...>)
+{
+    return std::array<FieldSchema, sizeof...(indices)>{makeStructureFieldSchema<TCfg, indices, nameFormat>()...};
+}
+
+template<typename TCfg, NameFormat nameFormat>
+inline constexpr auto configSchemaFields =
+        makeConfigSchemaFields<TCfg, nameFormat>(std::make_index_sequence<pfr::tuple_size_v<TCfg>>{});
+
+// Schema of a runtime reflection config is created from its registered fields on the first call, the converted field
+// names are stored separately, so the schema entries can refer to them
+template<typename TCfg, NameFormat nameFormat>
+const std::vector<std::string>& registeredSchemaFieldNames()
+{
+    static const auto names = []
+    {
+        auto result = std::vector<std::string>{};
+        for (const auto& field : registeredFields<TCfg>())
+            result.emplace_back(convertName(nameFormat, field.name));
+        return result;
+    }();
+    return names;
+}
+
+template<typename TCfg, NameFormat nameFormat>
+ConfigSchema registeredConfigSchema()
+{
+    static const auto fields = []
+    {
+        const auto& names = registeredSchemaFieldNames<TCfg, nameFormat>();
+        auto result = std::vector<FieldSchema>{};
+        visitRegisteredFields<TCfg>(
+                [&](auto member, const std::string&)
+                {
+                    const auto index = result.size();
+                    result.emplace_back(makeFieldSchema<member_field_t<decltype(member)::value>, nameFormat>(
+                            names[index],
+                            false,
+                            registeredFields<TCfg>()[index].isCopyNodeList));
+                    return true;
+                });
+        return result;
+    }();
+    return {fields.data(), fields.size()};
+}
+
+template<typename TCfg, NameFormat nameFormat>
+constexpr ConfigSchema configSchema()
+{
+    if constexpr (std::is_base_of_v<figcone::Config, TCfg>)
+        return registeredConfigSchema<TCfg, nameFormat>();
+    else
+        return {configSchemaFields<TCfg, nameFormat>.data(), configSchemaFields<TCfg, nameFormat>.size()};
+}
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_SCHEMA_H
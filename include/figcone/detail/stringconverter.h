@@ -1,10 +1,19 @@
 #ifndef FIGCONE_STRINGCONVERTER_H
 #define FIGCONE_STRINGCONVERTER_H
 
+#include "enumconverter.h"
+#include "exceptions.h"
+#include "utils.h"
 #include <figcone/detail/external/eel/type_traits.h>
 #include <figcone_tree/errors.h>
 #include <figcone_tree/stringconverter.h>
+#include <charconv>
+#include <limits>
+#include <optional>
+#include <sstream>
 #include <string>
+#include <system_error>
+#include <type_traits>
 #include <variant>
 
 namespace figcone::detail {
@@ -13,6 +22,50 @@ struct StringConversionError {
     std::string message;
 };
 
+template<typename T>
+constexpr bool isCharacterType()
+{
+    return std::is_same_v<T, char> || std::is_same_v<T, signed char> || std::is_same_v<T, unsigned char> ||
+            std::is_same_v<T, wchar_t> || std::is_same_v<T, char16_t> || std::is_same_v<T, char32_t>
+#ifdef __cpp_char8_t
+            || std::is_same_v<T, char8_t>
+#endif
+            ;
+}
+
+// Numbers are read with std::from_chars, which is much faster than reading from std::stringstream. Floating point
+// types are supported only by standard libraries that define __cpp_lib_to_chars.
+template<typename T>
+constexpr bool canBeReadWithFromChars()
+{
+    if constexpr (std::is_floating_point_v<T>) {
+#ifdef __cpp_lib_to_chars
+        return true;
+#else
+        return false;
+#endif
+    }
+    else
+        return std::is_integral_v<T> && !std::is_same_v<T, bool> && !isCharacterType<T>();
+}
+
+// Returns an empty value for the strings that std::from_chars doesn't read completely. They're read with
+// std::stringstream afterwards, so values like "+1" or " 1" and the conversion errors are handled as before.
+template<typename T>
+std::optional<T> numberFromChars(const std::string& data)
+{
+    auto value = T{};
+    const auto* end = data.data() + data.size();
+    auto [ptr, error] = std::from_chars(data.data(), end, value);
+    if (error != std::errc{} || ptr != end)
+        return {};
+    // std::stringstream doesn't read infinity and NaN, comparisons with NaN are false
+    if constexpr (std::is_floating_point_v<T>)
+        if (!(value >= std::numeric_limits<T>::lowest() && value <= std::numeric_limits<T>::max()))
+            return {};
+    return value;
+}
+
 template<typename T>
 std::optional<T> fromString(const std::string& data)
 {
@@ -26,9 +79,23 @@ std::optional<T> fromString(const std::string& data)
         return value;
     };
 
+    if constexpr (canBeReadWithFromChars<tree::eel::remove_optional_t<T>>()) {
+        if (auto number = numberFromChars<tree::eel::remove_optional_t<T>>(data))
+            return T{*number};
+    }
+
     if constexpr (std::is_convertible_v<std::string, tree::eel::remove_optional_t<T>>) {
         return data;
     }
+    else if constexpr (is_basic_string_v<tree::eel::remove_optional_t<T>>) {
+        return tree::eel::remove_optional_t<T>(data.begin(), data.end());
+    }
+    else if constexpr (canBeReadAsEnum<tree::eel::remove_optional_t<T>>()) {
+        auto value = enumFromString<tree::eel::remove_optional_t<T>>(data);
+        if (!value.has_value())
+            return {};
+        return T{*value};
+    }
     else if constexpr (tree::eel::is_optional_v<T>) {
         auto value = T{};
         value.emplace();
@@ -40,11 +107,23 @@ std::optional<T> fromString(const std::string& data)
     }
 }
 
+template<typename TField>
+constexpr auto canBeReadAsParam()
+{
+    return detail::is_string_streamable_v<TField> || //
+            eel::is_complete_type_v<StringConverter<TField>> ||
+            detail::is_string_streamable_v<tree::eel::remove_optional_t<TField>> ||
+            eel::is_complete_type_v<StringConverter<tree::eel::remove_optional_t<TField>>> ||
+            canBeReadAsEnum<tree::eel::remove_optional_t<TField>>();
+}
+
 template<typename T>
 std::variant<T, StringConversionError> convertFromString(const std::string& data)
 {
+#if FIGCONE_EXCEPTIONS_ENABLED
     try {
-        const auto result = [&]
+#endif
+        auto result = [&]
         {
             if constexpr (eel::is_complete_type_v<StringConverter<T>>)
                 return StringConverter<T>::fromString(data);
@@ -55,7 +134,8 @@ std::variant<T, StringConversionError> convertFromString(const std::string& data
         if (!result.has_value())
             return StringConversionError{};
         else
-            return result.value();
+            return std::move(*result);
+#if FIGCONE_EXCEPTIONS_ENABLED
     }
     catch (const ValidationError& error) {
         return StringConversionError{error.what()};
@@ -63,6 +143,7 @@ std::variant<T, StringConversionError> convertFromString(const std::string& data
     catch (...) {
         return StringConversionError{};
     }
+#endif
 }
 
 } //namespace figcone::detail
@@ -0,0 +1,173 @@
+#ifndef FIGCONE_TREEMERGE_H
+#define FIGCONE_TREEMERGE_H
+
+#include <figcone/configlayer.h>
+#include <figcone/errors.h>
+#include <figcone/expected.h>
+#include <figcone_tree/tree.h>
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace figcone::detail {
+
+struct LayerNode {
+    const TreeNode* node;
+    const std::string* layerName;
+};
+
+struct LayerParam {
+    const TreeParam* param;
+    const std::string* layerName;
+};
+
+// Stores the names of the layers that have supplied the elements of a merged tree. Merged nodes can consist of the
+// elements of several layers.
+class TreeOrigins {
+public:
+    void add(const TreeParam& param, const std::string& layerName)
+    {
+        paramLayers_.emplace(&param, &layerName);
+    }
+
+    void add(const TreeNode& node, const std::vector<LayerNode>& layerNodes)
+    {
+        auto& layerNames = nodeLayers_[&node];
+        for (const auto& layerNode : layerNodes)
+            if (std::find(layerNames.begin(), layerNames.end(), layerNode.layerName) == layerNames.end())
+                layerNames.push_back(layerNode.layerName);
+    }
+
+    std::string errorPrefix(const TreeParam& param) const
+    {
+        auto it = paramLayers_.find(&param);
+        if (it == paramLayers_.end())
+            return {};
+        return "Config layer '" + *it->second + "': ";
+    }
+
+    std::string errorPrefix(const TreeNode& node) const
+    {
+        auto it = nodeLayers_.find(&node);
+        if (it == nodeLayers_.end() || it->second.empty())
+            return {};
+        const auto& layerNames = it->second;
+        auto result = std::string{layerNames.size() == 1 ? "Config layer " : "Config layers "};
+        for (auto i = std::size_t{}; i < layerNames.size(); ++i)
+            result += (i ? ", '" : "'") + *layerNames[i] + "'";
+        return result + ": ";
+    }
+
+private:
+    std::unordered_map<const TreeParam*, const std::string*> paramLayers_;
+    std::unordered_map<const TreeNode*, std::vector<const std::string*>> nodeLayers_;
+};
+
+inline void mergeLayerNodes(TreeNode& dst, const std::vector<LayerNode>& layerNodes, TreeOrigins& origins);
+
+inline bool isMergeableNode(const TreeNode& node)
+{
+    return node.isItem();
+}
+
+inline void copyLayerNode(TreeNode& dst, const std::string& name, const LayerNode& layerNode, TreeOrigins& origins)
+{
+    const auto& src = *layerNode.node;
+    if (src.isItem() && src.isList()) {
+        auto& node = dst.asItem().addAny(name, src.position());
+        if (src.asList().size() == 0) {
+            mergeLayerNodes(node, {layerNode}, origins);
+            return;
+        }
+        origins.add(node, {layerNode});
+        for (auto i = 0; i < src.asList().size(); ++i) {
+            const auto& srcElement = src.asList().at(i);
+            auto& element = node.asList().emplaceBack(srcElement.position());
+            mergeLayerNodes(element, {{&srcElement, layerNode.layerName}}, origins);
+        }
+    }
+    else if (src.isList()) {
+        auto& node = dst.asItem().addNodeList(name, src.position());
+        origins.add(node, {layerNode});
+        for (auto i = 0; i < src.asList().size(); ++i) {
+            const auto& srcElement = src.asList().at(i);
+            auto& element = node.asList().emplaceBack(srcElement.position());
+            mergeLayerNodes(element, {{&srcElement, layerNode.layerName}}, origins);
+        }
+    }
+    else {
+        auto& node = dst.asItem().addNode(name, src.position());
+        mergeLayerNodes(node, {layerNode}, origins);
+    }
+}
+
+// Merging rules:
+//  * a parameter or a parameter list of a later layer replaces the field with the same name from the previous layers;
+//  * nodes and dictionaries are merged recursively;
+//  * a node list of a later layer replaces the field with the same name from the previous layers.
+inline void mergeLayerNodes(TreeNode& dst, const std::vector<LayerNode>& layerNodes, TreeOrigins& origins)
+{
+    origins.add(dst, layerNodes);
+    auto params = std::map<std::string, LayerParam>{};
+    auto nodes = std::map<std::string, std::vector<LayerNode>>{};
+    for (const auto& layerNode : layerNodes) {
+        const auto& item = layerNode.node->asItem();
+        for (const auto& paramName : item.paramNames()) {
+            params.insert_or_assign(paramName, LayerParam{&item.param(paramName), layerNode.layerName});
+            nodes.erase(paramName);
+        }
+        for (const auto& nodeName : item.nodeNames()) {
+            const auto& node = item.node(nodeName);
+            params.erase(nodeName);
+            auto& nodeLayers = nodes[nodeName];
+            if (!isMergeableNode(node) || (!nodeLayers.empty() && !isMergeableNode(*nodeLayers.back().node)))
+                nodeLayers.clear();
+            nodeLayers.push_back({&node, layerNode.layerName});
+        }
+    }
+
+    for (const auto& [paramName, layerParam] : params) {
+        if (layerParam.param->isList())
+            dst.asItem().addParamList(paramName, layerParam.param->valueList(), layerParam.param->position());
+        else
+            dst.asItem().addParam(paramName, layerParam.param->value(), layerParam.param->position());
+    }
+    for (const auto& [paramName, layerParam] : params)
+        origins.add(dst.asItem().param(paramName), *layerParam.layerName);
+
+    for (const auto& [nodeName, nodeLayers] : nodes) {
+        if (nodeLayers.size() == 1)
+            copyLayerNode(dst, nodeName, nodeLayers.front(), origins);
+        else {
+            auto& node = dst.asItem().addNode(nodeName, nodeLayers.back().node->position());
+            mergeLayerNodes(node, nodeLayers, origins);
+        }
+    }
+}
+
+inline Expected<Tree, ConfigError> mergeLayers(
+        const std::vector<ConfigLayer>& layers,
+        const std::vector<Tree>& layerTrees,
+        TreeOrigins& origins)
+{
+    auto layerNodes = std::vector<LayerNode>{};
+    for (auto i = std::size_t{}; i < layers.size(); ++i) {
+        const auto& root = layerTrees.at(i).root();
+        if (!root.isItem())
+            return Unexpected{
+                    ConfigError{"Config layer '" + layers.at(i).name() + "': root list documents can't be merged"}};
+        layerNodes.push_back({&root, &layers.at(i).name()});
+    }
+
+    auto root = makeTreeRoot();
+    mergeLayerNodes(*root, layerNodes, origins);
+    return Tree{std::move(root)};
+}
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_TREEMERGE_H
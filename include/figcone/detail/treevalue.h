@@ -0,0 +1,32 @@
+#ifndef FIGCONE_TREEVALUE_H
+#define FIGCONE_TREEVALUE_H
+
+#include "external/eel/type_traits.h"
+#include <figcone_tree/stringconverter.h>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace figcone::detail {
+
+// String fields without a user-defined StringConverter are set to the values of the config tree unchanged
+template<typename T>
+constexpr bool canBeMovedFromTree()
+{
+    return std::is_same_v<eel::remove_optional_t<T>, std::string> && !eel::is_complete_type_v<StringConverter<T>> &&
+            !eel::is_complete_type_v<StringConverter<eel::remove_optional_t<T>>>;
+}
+
+// Values are moved only from the trees owned by ConfigReader::readTree, which discards them after loading. Readers of copy
+// node lists don't move values, because the first element of such a list is loaded again for every element.
+// TreeParam provides only const access to the values, but the tree nodes aren't const objects, so the const_cast is
+// well-defined.
+template<typename T>
+T&& takeTreeValue(const T& value)
+{
+    return std::move(const_cast<T&>(value));
+}
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_TREEVALUE_H
@@ -1,20 +1,35 @@
 #ifndef FIGCONE_UNREGISTEREDFIELDUTILS_H
 #define FIGCONE_UNREGISTEREDFIELDUTILS_H
 
+#include "exceptions.h"
 #include "external/eel/type_traits.h"
+#include <figcone/errors.h>
 #include <figcone/unregisteredfieldhandler.h>
+#include <optional>
+#include <string>
 
 namespace figcone::detail {
 template<typename TCfg>
-void handleUnregisteredField(FieldType fieldType, const std::string& fieldName, const StreamPosition& position)
+std::optional<ConfigError> handleUnregisteredField(
+        FieldType fieldType,
+        const std::string& fieldName,
+        const StreamPosition& position)
 {
-    if constexpr (eel::is_complete_type_v<UnregisteredFieldHandler<TCfg>>)
-        UnregisteredFieldHandler<TCfg>{}(fieldType, fieldName, position);
+    if constexpr (eel::is_complete_type_v<UnregisteredFieldHandler<TCfg>>) {
+        auto errorMsg = catchErrorMessage<ConfigError>(
+                [&]
+                {
+                    UnregisteredFieldHandler<TCfg>{}(fieldType, fieldName, position);
+                });
+        if (errorMsg)
+            return ConfigError{*errorMsg};
+        return std::nullopt;
+    }
     else {
         if (fieldType == FieldType::Node)
-            throw ConfigError{"Unknown node '" + fieldName + "'", position};
+            return ConfigError{"Unknown node '" + fieldName + "'", position};
         else
-            throw ConfigError{"Unknown param '" + fieldName + "'", position};
+            return ConfigError{"Unknown param '" + fieldName + "'", position};
     }
 }
 
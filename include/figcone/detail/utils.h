@@ -3,7 +3,10 @@
 
 #include "initializedoptional.h"
 #include "external/eel/type_traits.h"
+#include <cstddef>
 #include <optional>
+#include <sstream>
+#include <string>
 #include <type_traits>
 #include <vector>
 
@@ -37,6 +40,35 @@ struct is_string_streamable<T, std::void_t<decltype(std::declval<std::stringstre
 template<typename T>
 inline constexpr auto is_string_streamable_v = is_string_streamable<T>::value;
 
+template<typename T, typename = void>
+struct is_string_extractable : std::false_type {};
+
+template<typename T>
+struct is_string_extractable<T, std::void_t<decltype(std::declval<std::stringstream&>() >> std::declval<T&>())>>
+    : std::true_type {};
+
+template<typename T>
+inline constexpr auto is_string_extractable_v = is_string_extractable<T>::value;
+
+template<typename T, typename = void>
+struct is_reservable : std::false_type {};
+
+template<typename T>
+struct is_reservable<T, std::void_t<decltype(std::declval<T&>().reserve(std::size_t{}))>> : std::true_type {};
+
+template<typename T>
+inline constexpr auto is_reservable_v = is_reservable<T>::value;
+
+// Matches std::string and strings with other allocators, like std::pmr::string
+template<typename T>
+struct is_basic_string : std::false_type {};
+
+template<typename TAllocator>
+struct is_basic_string<std::basic_string<char, std::char_traits<char>, TAllocator>> : std::true_type {};
+
+template<typename T>
+inline constexpr auto is_basic_string_v = is_basic_string<T>::value;
+
 } //namespace figcone::detail
 
 namespace figcone::eel {
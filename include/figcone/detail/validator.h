@@ -1,22 +1,24 @@
 #ifndef FIGCONE_VALIDATOR_H
 #define FIGCONE_VALIDATOR_H
 
+#include "exceptions.h"
 #include "iconfigentity.h"
 #include "ivalidator.h"
 #include "utils.h"
 #include "external/eel/type_traits.h"
 #include <figcone/errors.h>
-#include <functional>
+#include <optional>
+#include <string>
+#include <type_traits>
 
 namespace figcone::detail {
 
-template<typename T>
+// Validating function can report an error by throwing figcone::ValidationError or, if its result is convertible to
+// std::optional<std::string>, by returning a non-empty error message. Other results are ignored.
+template<typename T, typename TValidatingFunc>
 class Validator : public IValidator {
 public:
-    Validator(
-            IConfigEntity& entity,
-            T& entityValue,
-            std::function<void(const eel::remove_optional_t<T>&)> validatingFunc)
+    Validator(IConfigEntity& entity, T& entityValue, TValidatingFunc validatingFunc)
         : entity_(entity)
         , entityValue_(entityValue)
         , validatingFunc_(std::move(validatingFunc))
@@ -24,26 +26,49 @@ public:
     }
 
 private:
-    void validate() override
+    std::optional<ConfigError> validate() override
     {
-        try {
-            if constexpr (eel::is_optional_v<T> || is_initialized_optional_v<T>) {
-                if (entityValue_)
-                    validatingFunc_(*entityValue_);
-            }
-            else
-                validatingFunc_(entityValue_);
-        }
-        catch (const ValidationError& e) {
-            throw ConfigError{entity_.description() + ": " + e.what(), entity_.position()};
+        auto errorMsg = std::optional<std::string>{};
+        if constexpr (eel::is_optional_v<T> || is_initialized_optional_v<T>) {
+            if (entityValue_)
+                errorMsg = validateValue(*entityValue_);
         }
+        else
+            errorMsg = validateValue(entityValue_);
+
+        if (errorMsg)
+            return ConfigError{entity_.description() + ": " + *errorMsg, entity_.position()};
+        return std::nullopt;
+    }
+
+    std::optional<std::string> validateValue(const eel::remove_optional_t<T>& value)
+    {
+        using Result = std::invoke_result_t<TValidatingFunc&, const eel::remove_optional_t<T>&>;
+        if constexpr (std::is_convertible_v<Result, std::optional<std::string>>)
+            return validatingFunc_(value);
+        else
+            return catchErrorMessage<ValidationError>(
+                    [&]
+                    {
+                        validatingFunc_(value);
+                    });
+    }
+
+    StreamPosition position() override
+    {
+        return entity_.position();
+    }
+
+    const IConfigEntity& entity() const override
+    {
+        return entity_;
     }
 
     IConfigEntity& entity_;
     T& entityValue_;
-    std::function<void(const eel::remove_optional_t<T>&)> validatingFunc_;
+    TValidatingFunc validatingFunc_;
 };
 
 } //namespace figcone::detail
 
-#endif //FIGCONE_VALIDATOR_H
\ No newline at end of file
+#endif //FIGCONE_VALIDATOR_H
@@ -0,0 +1,44 @@
+#ifndef FIGCONE_ENVIRONMENTPARSER_H
+#define FIGCONE_ENVIRONMENTPARSER_H
+
+#include "nameformat.h"
+#include "detail/environmentmapping.h"
+#include <figcone_tree/iparser.h>
+#include <figcone_tree/tree.h>
+#include <istream>
+#include <string>
+
+namespace figcone {
+
+// Reads config parameters of TCfg from the environment variables, e.g. the parameter 'poolSize' of the node 'db' is
+// read from the variable APP_DB__POOL_SIZE when the prefix is "APP". Parameter list values are separated with commas.
+template<typename TCfg>
+class EnvironmentParser : public IParser {
+public:
+    explicit EnvironmentParser(
+            const std::string& prefix,
+            NameFormat nameFormat = NameFormat::Original,
+            const char* const* environment = nullptr)
+        : variablePrefix_{prefix.empty() ? std::string{} : prefix + "_"}
+        , nameFormat_{nameFormat}
+        , environment_{environment}
+    {
+    }
+
+    Tree parse(std::istream&) override
+    {
+        return detail::readEnvironment(
+                detail::environmentMapping<TCfg>(nameFormat_),
+                variablePrefix_,
+                environment_ ? environment_ : detail::processEnvironment());
+    }
+
+private:
+    std::string variablePrefix_;
+    NameFormat nameFormat_;
+    const char* const* environment_;
+};
+
+} //namespace figcone
+
+#endif //FIGCONE_ENVIRONMENTPARSER_H
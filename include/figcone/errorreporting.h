@@ -0,0 +1,13 @@
+#ifndef FIGCONE_ERRORREPORTING_H
+#define FIGCONE_ERRORREPORTING_H
+
+namespace figcone {
+
+enum class ErrorReporting {
+    FirstError,
+    AllErrors
+};
+
+} //namespace figcone
+
+#endif //FIGCONE_ERRORREPORTING_H
@@ -2,5 +2,46 @@
 #define FIGCONE_ERRORS_H
 
 #include <figcone_tree/errors.h>
+#include <figcone_tree/streamposition.h>
+#include <string>
+#include <vector>
 
-#endif //FIGCONE_ERRORS_H
\ No newline at end of file
+namespace figcone {
+
+struct ConfigErrorInfo {
+    std::string message;
+    StreamPosition position;
+};
+
+class ConfigErrorList : public ConfigError {
+public:
+    explicit ConfigErrorList(std::vector<ConfigErrorInfo> errors)
+        : ConfigError{joinErrorMessages(errors)}
+        , errors_{std::move(errors)}
+    {
+    }
+
+    const std::vector<ConfigErrorInfo>& errors() const
+    {
+        return errors_;
+    }
+
+private:
+    static std::string joinErrorMessages(const std::vector<ConfigErrorInfo>& errors)
+    {
+        auto result = std::string{};
+        for (const auto& error : errors) {
+            if (!result.empty())
+                result += "\n";
+            result += error.message;
+        }
+        return result;
+    }
+
+private:
+    std::vector<ConfigErrorInfo> errors_;
+};
+
+} //namespace figcone
+
+#endif //FIGCONE_ERRORS_H
@@ -0,0 +1,135 @@
+#ifndef FIGCONE_EXPECTED_H
+#define FIGCONE_EXPECTED_H
+
+#include "detail/exceptions.h"
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace figcone {
+
+template<typename TError>
+class Unexpected {
+public:
+    explicit Unexpected(TError error)
+        : error_{std::move(error)}
+    {
+    }
+
+    const TError& error() const&
+    {
+        return error_;
+    }
+
+    TError&& error() &&
+    {
+        return std::move(error_);
+    }
+
+private:
+    TError error_;
+};
+
+template<typename TError>
+Unexpected(TError) -> Unexpected<TError>;
+
+// Minimal C++17 replacement of std::expected, used as the result type of the exception-free reading API
+template<typename T, typename TError>
+class Expected {
+public:
+    template<
+            typename TArg = T,
+            std::enable_if_t<std::is_constructible_v<T, TArg&&> && !std::is_same_v<std::decay_t<TArg>, Expected>>* =
+                    nullptr>
+    Expected(TArg&& value)
+        : data_{std::in_place_index<0>, std::forward<TArg>(value)}
+    {
+    }
+
+    template<typename TOtherError, std::enable_if_t<std::is_constructible_v<TError, TOtherError&&>>* = nullptr>
+    Expected(Unexpected<TOtherError> error)
+        : data_{std::in_place_index<1>, std::move(error).error()}
+    {
+    }
+
+    bool has_value() const
+    {
+        return data_.index() == 0;
+    }
+
+    explicit operator bool() const
+    {
+        return has_value();
+    }
+
+    T& value() &
+    {
+        if (!has_value())
+            detail::throwError(error());
+        return *std::get_if<0>(&data_);
+    }
+
+    const T& value() const&
+    {
+        if (!has_value())
+            detail::throwError(error());
+        return *std::get_if<0>(&data_);
+    }
+
+    T&& value() &&
+    {
+        if (!has_value())
+            detail::throwError(error());
+        return std::move(*std::get_if<0>(&data_));
+    }
+
+    template<typename U>
+    T value_or(U&& defaultValue) const&
+    {
+        if (!has_value())
+            return static_cast<T>(std::forward<U>(defaultValue));
+        return *std::get_if<0>(&data_);
+    }
+
+    const TError& error() const&
+    {
+        return *std::get_if<1>(&data_);
+    }
+
+    TError&& error() &&
+    {
+        return std::move(*std::get_if<1>(&data_));
+    }
+
+    T& operator*() &
+    {
+        return *std::get_if<0>(&data_);
+    }
+
+    const T& operator*() const&
+    {
+        return *std::get_if<0>(&data_);
+    }
+
+    T&& operator*() &&
+    {
+        return std::move(*std::get_if<0>(&data_));
+    }
+
+    T* operator->()
+    {
+        return std::get_if<0>(&data_);
+    }
+
+    const T* operator->() const
+    {
+        return std::get_if<0>(&data_);
+    }
+
+private:
+    std::variant<T, TError> data_;
+};
+
+} //namespace figcone
+
+#endif //FIGCONE_EXPECTED_H
@@ -0,0 +1,32 @@
+#ifndef FIGCONE_FIELDFOOTPRINT_H
+#define FIGCONE_FIELDFOOTPRINT_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace figcone {
+
+struct FieldFootprint {
+    // Dot separated path of the field, fields of node list elements are combined under the path of the node list
+    std::string path;
+    // sizeof of the field, summed over all node list elements
+    std::size_t size = 0;
+    // Estimated heap memory owned by the field including its nested fields
+    std::size_t heapBytes = 0;
+    // Allocated but unused capacity of the field's containers including its nested fields
+    std::size_t unusedCapacityBytes = 0;
+    // Set when the capacity of the field's own container is more than twice its size
+    bool hasWastedCapacity = false;
+};
+
+struct ConfigFootprint {
+    std::size_t size = 0;
+    std::size_t heapBytes = 0;
+    // Footprints of all config fields sorted by their total memory usage in descending order
+    std::vector<FieldFootprint> fields;
+};
+
+} //namespace figcone
+
+#endif //FIGCONE_FIELDFOOTPRINT_H
@@ -0,0 +1,102 @@
+#ifndef FIGCONE_FIELDSCHEMA_H
+#define FIGCONE_FIELDSCHEMA_H
+
+#include <cstddef>
+#include <string_view>
+
+namespace figcone {
+
+enum class FieldKind {
+    Param,
+    ParamList,
+    Node,
+    NodeList,
+    Dict
+};
+
+// Type of the values of parameters, and of the elements of parameter lists and dictionaries
+enum class FieldValueType {
+    Bool,
+    Integer,
+    Real,
+    String,
+    Other
+};
+
+class ConfigSchema;
+
+struct FieldSchema {
+    // Field name converted to the name format of the schema
+    std::string_view name;
+    FieldKind kind = FieldKind::Param;
+    // Set to FieldValueType::Other for nodes and node lists
+    FieldValueType valueType = FieldValueType::Other;
+    // Set for fields of optional types and fields registered with figcone::OptionalField
+    bool isOptional = false;
+    // Set for node lists registered with figcone::CopyNodeListField or declared with FIGCONE_COPY_NODELIST
+    bool isCopyNodeList = false;
+    // Nested schemas are resolved lazily to support node lists containing elements of the parent config type
+    ConfigSchema (*nestedSchemaFunc)() = nullptr;
+
+    // Returns the schema of the node or of the node list elements, and an empty schema for other fields
+    constexpr ConfigSchema nestedSchema() const;
+};
+
+class ConfigSchema {
+public:
+    constexpr ConfigSchema() = default;
+    constexpr ConfigSchema(const FieldSchema* fields, std::size_t size)
+        : fields_{fields}
+        , size_{size}
+    {
+    }
+
+    constexpr const FieldSchema* begin() const
+    {
+        return fields_;
+    }
+
+    constexpr const FieldSchema* end() const
+    {
+        return fields_ + size_;
+    }
+
+    constexpr std::size_t size() const
+    {
+        return size_;
+    }
+
+    constexpr bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    constexpr const FieldSchema& operator[](std::size_t index) const
+    {
+        return fields_[index];
+    }
+
+    // Returns nullptr if the schema doesn't contain a field with the specified name
+    constexpr const FieldSchema* find(std::string_view name) const
+    {
+        for (const auto& field : *this)
+            if (field.name == name)
+                return &field;
+        return nullptr;
+    }
+
+private:
+    const FieldSchema* fields_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+constexpr ConfigSchema FieldSchema::nestedSchema() const
+{
+    if (!nestedSchemaFunc)
+        return {};
+    return nestedSchemaFunc();
+}
+
+} //namespace figcone
+
+#endif //FIGCONE_FIELDSCHEMA_H
@@ -1,6 +1,17 @@
 #ifndef FIGCONE_FIGCONE_H
 #define FIGCONE_FIGCONE_H
 
+#include "chrometraceobserver.h"
+#include "commandlineparser.h"
 #include "config.h"
+#include "configreader.h"
+#include "configschema.h"
+#include "constraints.h"
+#include "environmentparser.h"
+#include "fingerprint.h"
+#include "footprint.h"
+#include "internedstring.h"
+#include "parallelvalidation.h"
+#include "validators.h"
 
 #endif //FIGCONE_FIGCONE_H
@@ -0,0 +1,27 @@
+#ifndef FIGCONE_FINGERPRINT_H
+#define FIGCONE_FINGERPRINT_H
+
+#include "configreadercore.h"
+#include "detail/fingerprintutils.h"
+#include "detail/hasher.h"
+#include <cstdint>
+
+namespace figcone {
+
+template<typename TCfg>
+std::uint64_t fingerprint(const TCfg& cfg)
+{
+    auto hasher = detail::Hasher{};
+    detail::hashValue(hasher, cfg);
+    return hasher.result();
+}
+
+template<typename TCfg>
+bool equal(const TCfg& lhs, const TCfg& rhs)
+{
+    return detail::equalValues(lhs, rhs);
+}
+
+} //namespace figcone
+
+#endif //FIGCONE_FINGERPRINT_H
@@ -0,0 +1,24 @@
+#ifndef FIGCONE_FOOTPRINT_H
+#define FIGCONE_FOOTPRINT_H
+
+#include "configreadercore.h"
+#include "fieldfootprint.h"
+#include "detail/footprintutils.h"
+#include <string>
+#include <utility>
+
+namespace figcone {
+
+// Returns the memory usage of a config object. Heap usage is estimated from the sizes and capacities of the strings and
+// containers stored in the config fields, so it's approximate for node based containers.
+template<typename TCfg>
+ConfigFootprint footprint(const TCfg& cfg)
+{
+    auto collector = detail::FootprintCollector{};
+    const auto heapFootprint = detail::heapFootprint(collector, cfg, std::string{});
+    return {sizeof(TCfg), heapFootprint.heapBytes, std::move(collector).result()};
+}
+
+} //namespace figcone
+
+#endif //FIGCONE_FOOTPRINT_H
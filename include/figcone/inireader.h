@@ -0,0 +1,18 @@
+#ifndef FIGCONE_INIREADER_H
+#define FIGCONE_INIREADER_H
+
+#include "configreadercore.h"
+#include "detail/figcone_ini_import.h"
+
+#ifdef FIGCONE_INI_AVAILABLE
+namespace figcone::detail {
+
+template<typename TCfg>
+struct FormatParser<IniFormat, TCfg> {
+    using type = figcone::ini::Parser;
+};
+
+} //namespace figcone::detail
+#endif
+
+#endif //FIGCONE_INIREADER_H
@@ -0,0 +1,154 @@
+#ifndef FIGCONE_INTERNEDSTRING_H
+#define FIGCONE_INTERNEDSTRING_H
+
+#include <figcone_tree/stringconverter.h>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace figcone {
+
+namespace detail {
+
+// Global table of interned strings. Strings are never removed, so the interned values must come from a limited set,
+// like names of regions or tiers repeated in the elements of large node lists.
+class InternTable {
+public:
+    const std::string* intern(std::string_view value)
+    {
+        if (value.empty())
+            return &emptyString();
+
+        auto lock = std::lock_guard{mutex_};
+        auto it = index_.find(value);
+        if (it != index_.end())
+            return it->second;
+
+        // references to deque elements stay valid when new elements are added to the back
+        const auto& result = strings_.emplace_back(value);
+        index_.emplace(result, &result);
+        return &result;
+    }
+
+    std::size_t size() const
+    {
+        auto lock = std::lock_guard{mutex_};
+        return strings_.size();
+    }
+
+    static const std::string& emptyString()
+    {
+        static const auto value = std::string{};
+        return value;
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::deque<std::string> strings_;
+    std::unordered_map<std::string_view, const std::string*> index_;
+};
+
+inline InternTable& internTable()
+{
+    static auto table = InternTable{};
+    return table;
+}
+
+} //namespace detail
+
+// String parameter type sharing a single copy of equal values. Reading large node lists with repeated string values
+// into InternedString fields stores a pointer per value instead of a separate std::string.
+class InternedString {
+public:
+    InternedString() = default;
+    explicit InternedString(std::string_view value)
+        : value_{detail::internTable().intern(value)}
+    {
+    }
+
+    const std::string& str() const
+    {
+        return *value_;
+    }
+
+    const char* c_str() const
+    {
+        return value_->c_str();
+    }
+
+    std::size_t size() const
+    {
+        return value_->size();
+    }
+
+    bool empty() const
+    {
+        return value_->empty();
+    }
+
+    operator const std::string&() const
+    {
+        return *value_;
+    }
+
+    operator std::string_view() const
+    {
+        return *value_;
+    }
+
+    // equal interned strings share the same value
+    friend bool operator==(const InternedString& lhs, const InternedString& rhs)
+    {
+        return lhs.value_ == rhs.value_;
+    }
+
+    friend bool operator!=(const InternedString& lhs, const InternedString& rhs)
+    {
+        return lhs.value_ != rhs.value_;
+    }
+
+    friend bool operator<(const InternedString& lhs, const InternedString& rhs)
+    {
+        return *lhs.value_ < *rhs.value_;
+    }
+
+    friend std::ostream& operator<<(std::ostream& stream, const InternedString& value)
+    {
+        return stream << *value.value_;
+    }
+
+private:
+    const std::string* value_ = &detail::InternTable::emptyString();
+};
+
+// Returns the number of distinct non-empty values interned by InternedString
+inline std::size_t internedStringCount()
+{
+    return detail::internTable().size();
+}
+
+template<>
+struct StringConverter<InternedString> {
+    static std::optional<InternedString> fromString(const std::string& data)
+    {
+        return InternedString{data};
+    }
+};
+
+} //namespace figcone
+
+template<>
+struct std::hash<figcone::InternedString> {
+    std::size_t operator()(const figcone::InternedString& value) const
+    {
+        return std::hash<const std::string*>{}(&value.str());
+    }
+};
+
+#endif //FIGCONE_INTERNEDSTRING_H
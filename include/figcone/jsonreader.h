@@ -0,0 +1,18 @@
+#ifndef FIGCONE_JSONREADER_H
+#define FIGCONE_JSONREADER_H
+
+#include "configreadercore.h"
+#include "detail/figcone_json_import.h"
+
+#ifdef FIGCONE_JSON_AVAILABLE
+namespace figcone::detail {
+
+template<typename TCfg>
+struct FormatParser<JsonFormat, TCfg> {
+    using type = figcone::json::Parser;
+};
+
+} //namespace figcone::detail
+#endif
+
+#endif //FIGCONE_JSONREADER_H
@@ -0,0 +1,114 @@
+#ifndef FIGCONE_PARALLELVALIDATION_H
+#define FIGCONE_PARALLELVALIDATION_H
+
+#include "validationexecutor.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace figcone {
+
+// Runs the deferred validators on a pool of worker threads and on the calling thread.
+// Worker threads are started once and reused by all validation phases of the config readers using the pool.
+class ValidationThreadPool : public IValidationExecutor {
+public:
+    explicit ValidationThreadPool(std::size_t threadCount = std::max(std::thread::hardware_concurrency(), 1u))
+    {
+        for (auto i = std::size_t{1}; i < threadCount; ++i)
+            threads_.emplace_back(
+                    [this]
+                    {
+                        runWorker();
+                    });
+    }
+
+    ~ValidationThreadPool() override
+    {
+        {
+            auto lock = std::unique_lock{mutex_};
+            isStopped_ = true;
+        }
+        taskStarted_.notify_all();
+        for (auto& thread : threads_)
+            thread.join();
+    }
+
+    ValidationThreadPool(const ValidationThreadPool&) = delete;
+    ValidationThreadPool& operator=(const ValidationThreadPool&) = delete;
+
+    void run(std::size_t taskCount, const std::function<void(std::size_t taskIndex)>& task) override
+    {
+        auto nextIndex = std::atomic<std::size_t>{0};
+        runOnAllThreads(
+                [&]
+                {
+                    for (auto i = nextIndex++; i < taskCount; i = nextIndex++)
+                        task(i);
+                });
+    }
+
+private:
+    // Runs the task on all worker threads and on the calling thread, and waits until all of them finish it
+    void runOnAllThreads(const std::function<void()>& task)
+    {
+        {
+            auto lock = std::unique_lock{mutex_};
+            task_ = &task;
+            ++taskId_;
+            runningWorkerCount_ = threads_.size();
+        }
+        taskStarted_.notify_all();
+        task();
+
+        auto lock = std::unique_lock{mutex_};
+        taskFinished_.wait(
+                lock,
+                [this]
+                {
+                    return runningWorkerCount_ == 0;
+                });
+        task_ = nullptr;
+    }
+
+    void runWorker()
+    {
+        auto lastTaskId = std::size_t{0};
+        auto lock = std::unique_lock{mutex_};
+        while (true) {
+            taskStarted_.wait(
+                    lock,
+                    [&]
+                    {
+                        return isStopped_ || taskId_ != lastTaskId;
+                    });
+            if (isStopped_)
+                return;
+            lastTaskId = taskId_;
+            const auto& task = *task_;
+            lock.unlock();
+            task();
+            lock.lock();
+            if (--runningWorkerCount_ == 0)
+                taskFinished_.notify_one();
+        }
+    }
+
+private:
+    std::vector<std::thread> threads_;
+    std::mutex mutex_;
+    std::condition_variable taskStarted_;
+    std::condition_variable taskFinished_;
+    const std::function<void()>* task_ = nullptr;
+    std::size_t taskId_ = 0;
+    std::size_t runningWorkerCount_ = 0;
+    bool isStopped_ = false;
+};
+
+} //namespace figcone
+
+#endif //FIGCONE_PARALLELVALIDATION_H
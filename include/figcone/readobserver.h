@@ -0,0 +1,67 @@
+#ifndef FIGCONE_READOBSERVER_H
+#define FIGCONE_READOBSERVER_H
+
+#include <cstddef>
+#include <string_view>
+
+namespace figcone {
+
+enum class ReadPhase {
+    FileRead,
+    Parse,
+    Load,
+    Node,
+    NodeList,
+    NodeListElement,
+    Validation,
+    PostProcessing
+};
+
+inline std::string_view readPhaseName(ReadPhase phase)
+{
+    switch (phase) {
+    case ReadPhase::FileRead:
+        return "file read";
+    case ReadPhase::Parse:
+        return "parse";
+    case ReadPhase::Load:
+        return "load";
+    case ReadPhase::Node:
+        return "node";
+    case ReadPhase::NodeList:
+        return "node list";
+    case ReadPhase::NodeListElement:
+        return "node list element";
+    case ReadPhase::Validation:
+        return "validation";
+    case ReadPhase::PostProcessing:
+        return "post-processing";
+    }
+    return {};
+}
+
+struct ReadPhaseInfo {
+    ReadPhase phase;
+    // Name of the node or the node list for the ReadPhase::Node and ReadPhase::NodeList phases,
+    // index of the element for the ReadPhase::NodeListElement phase,
+    // name of the config layer for the ReadPhase::Parse phase of ConfigReader::readLayers
+    std::string_view name;
+    // Size of the read file or of the parsed document, 0 if it's unknown
+    std::size_t byteCount = 0;
+    // Number of the node fields, of the node list elements or of the run validators
+    std::size_t elementCount = 0;
+};
+
+// Interface of an observer receiving the begin and end events of the config reading phases.
+// Phases are nested: the ReadPhase::Node and ReadPhase::NodeList phases of nested config nodes are reported inside
+// the ReadPhase::Load phase and inside the phases of their parent nodes.
+class IReadObserver {
+public:
+    virtual ~IReadObserver() = default;
+    virtual void onPhaseBegin(const ReadPhaseInfo& phaseInfo) = 0;
+    virtual void onPhaseEnd(const ReadPhaseInfo& phaseInfo) = 0;
+};
+
+} //namespace figcone
+
+#endif //FIGCONE_READOBSERVER_H
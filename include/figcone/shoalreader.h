@@ -0,0 +1,18 @@
+#ifndef FIGCONE_SHOALREADER_H
+#define FIGCONE_SHOALREADER_H
+
+#include "configreadercore.h"
+#include "detail/figcone_shoal_import.h"
+
+#ifdef FIGCONE_SHOAL_AVAILABLE
+namespace figcone::detail {
+
+template<typename TCfg>
+struct FormatParser<ShoalFormat, TCfg> {
+    using type = figcone::shoal::Parser;
+};
+
+} //namespace figcone::detail
+#endif
+
+#endif //FIGCONE_SHOALREADER_H
@@ -0,0 +1,18 @@
+#ifndef FIGCONE_TOMLREADER_H
+#define FIGCONE_TOMLREADER_H
+
+#include "configreadercore.h"
+#include "detail/figcone_toml_import.h"
+
+#ifdef FIGCONE_TOML_AVAILABLE
+namespace figcone::detail {
+
+template<typename TCfg>
+struct FormatParser<TomlFormat, TCfg> {
+    using type = figcone::toml::Parser;
+};
+
+} //namespace figcone::detail
+#endif
+
+#endif //FIGCONE_TOMLREADER_H
@@ -0,0 +1,20 @@
+#ifndef FIGCONE_VALIDATIONEXECUTOR_H
+#define FIGCONE_VALIDATIONEXECUTOR_H
+
+#include <cstddef>
+#include <functional>
+
+namespace figcone {
+
+// Interface of an executor of the validators deferred until the whole config is loaded.
+// run() must call the task once with every index from 0 to taskCount - 1 and return after all calls are finished.
+// Calls with different indices can be made concurrently, the task doesn't throw.
+class IValidationExecutor {
+public:
+    virtual ~IValidationExecutor() = default;
+    virtual void run(std::size_t taskCount, const std::function<void(std::size_t taskIndex)>& task) = 0;
+};
+
+} //namespace figcone
+
+#endif //FIGCONE_VALIDATIONEXECUTOR_H
@@ -0,0 +1,187 @@
+#ifndef FIGCONE_VALIDATORS_H
+#define FIGCONE_VALIDATORS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace figcone::detail {
+template<typename T>
+std::string validatedValueToString(const T& value)
+{
+    auto stream = std::stringstream{};
+    stream << value;
+    return stream.str();
+}
+
+// Integers of different signedness are compared by their values, like std::cmp_less from C++20, so an unsigned value
+// is never compared with a wrapped negative bound.
+template<typename TLhs, typename TRhs>
+bool isLess(const TLhs& lhs, const TRhs& rhs)
+{
+    if constexpr (std::is_integral_v<TLhs> && std::is_integral_v<TRhs>) {
+        static_assert(
+                !std::is_same_v<TLhs, bool> && !std::is_same_v<TRhs, bool>,
+                "Numeric bounds can't be used with bool values");
+        if constexpr (std::is_signed_v<TLhs> == std::is_signed_v<TRhs>)
+            return lhs < rhs;
+        else if constexpr (std::is_signed_v<TLhs>)
+            return lhs < 0 || static_cast<std::make_unsigned_t<TLhs>>(lhs) < rhs;
+        else
+            return rhs >= 0 && lhs < static_cast<std::make_unsigned_t<TRhs>>(rhs);
+    }
+    else
+        return lhs < rhs;
+}
+} //namespace figcone::detail
+
+// Built-in validators are configured with template parameters, so they can be used both with the
+// ensure<TValidator>() method of the runtime reflection interface and with the figcone::ValidatedField trait of the
+// static reflection interface. They report errors by returning a message instead of throwing
+// figcone::ValidationError, so they work in builds with disabled exceptions.
+// Bounds of Min, Max and InRange are compared with values without conversion to the value type, so Min<-1> accepts any
+// unsigned value. Floating point bounds require C++20, as C++17 doesn't allow floating point template parameters.
+namespace figcone::validator {
+
+template<auto minValue>
+struct Min {
+    template<typename T>
+    std::optional<std::string> operator()(const T& value) const
+    {
+        if (detail::isLess(value, minValue))
+            return "value can't be less than " + detail::validatedValueToString(minValue);
+        return std::nullopt;
+    }
+};
+
+template<auto maxValue>
+struct Max {
+    template<typename T>
+    std::optional<std::string> operator()(const T& value) const
+    {
+        if (detail::isLess(maxValue, value))
+            return "value can't be greater than " + detail::validatedValueToString(maxValue);
+        return std::nullopt;
+    }
+};
+
+template<auto minValue, auto maxValue>
+struct InRange {
+    template<typename T>
+    std::optional<std::string> operator()(const T& value) const
+    {
+        if (detail::isLess(value, minValue) || detail::isLess(maxValue, value))
+            return "value must be in range [" + detail::validatedValueToString(minValue) + ", " +
+                    detail::validatedValueToString(maxValue) + "]";
+        return std::nullopt;
+    }
+};
+
+struct NotEmpty {
+    template<typename T>
+    std::optional<std::string> operator()(const T& value) const
+    {
+        if (value.empty())
+            return "value can't be empty";
+        return std::nullopt;
+    }
+};
+
+template<std::size_t maxLength>
+struct MaxLength {
+    template<typename T>
+    std::optional<std::string> operator()(const T& value) const
+    {
+        if (value.size() > maxLength)
+            return "value length can't be greater than " + std::to_string(maxLength);
+        return std::nullopt;
+    }
+};
+
+// values must be a reference to a constexpr container with static storage duration, e.g.
+// static constexpr auto logLevels = std::array{"debug", "info", "error"};
+template<const auto& values>
+struct OneOf {
+    template<typename T>
+    std::optional<std::string> operator()(const T& value) const
+    {
+        for (const auto& allowedValue : values)
+            if (value == allowedValue)
+                return std::nullopt;
+
+        auto errorMsg = std::string{"value must be one of: "};
+        for (const auto& allowedValue : values) {
+            if (&allowedValue != &*std::begin(values))
+                errorMsg += ", ";
+            errorMsg += detail::validatedValueToString(allowedValue);
+        }
+        return errorMsg;
+    }
+};
+
+struct Sorted {
+    template<typename TList>
+    std::optional<std::string> operator()(const TList& list) const
+    {
+        if (!std::is_sorted(list.begin(), list.end()))
+            return "list must be sorted";
+        return std::nullopt;
+    }
+};
+
+struct Unique {
+    template<typename TList>
+    std::optional<std::string> operator()(const TList& list) const
+    {
+        auto elements = std::vector<const typename TList::value_type*>{};
+        elements.reserve(list.size());
+        for (const auto& element : list)
+            elements.push_back(&element);
+        std::sort(
+                elements.begin(),
+                elements.end(),
+                [](const auto* lhs, const auto* rhs)
+                {
+                    return *lhs < *rhs;
+                });
+        auto duplicate = std::adjacent_find(
+                elements.begin(),
+                elements.end(),
+                [](const auto* lhs, const auto* rhs)
+                {
+                    return *lhs == *rhs;
+                });
+        if (duplicate != elements.end())
+            return "list elements must be unique, '" + detail::validatedValueToString(**duplicate) + "' is repeated";
+        return std::nullopt;
+    }
+};
+
+// pattern must point to a string with static storage duration, e.g.
+// static constexpr char namePattern[] = "[a-z_]+";
+// The regular expression is compiled once for each pattern, not on every config reading.
+template<const char* pattern>
+struct MatchesRegex {
+    std::optional<std::string> operator()(const std::string& value) const
+    {
+        if (!std::regex_match(value, regex()))
+            return "value must match the regular expression '" + std::string{pattern} + "'";
+        return std::nullopt;
+    }
+
+private:
+    static const std::regex& regex()
+    {
+        static const auto compiledRegex = std::regex{pattern};
+        return compiledRegex;
+    }
+};
+
+} //namespace figcone::validator
+
+#endif //FIGCONE_VALIDATORS_H
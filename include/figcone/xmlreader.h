@@ -0,0 +1,18 @@
+#ifndef FIGCONE_XMLREADER_H
+#define FIGCONE_XMLREADER_H
+
+#include "configreadercore.h"
+#include "detail/figcone_xml_import.h"
+
+#ifdef FIGCONE_XML_AVAILABLE
+namespace figcone::detail {
+
+template<typename TCfg>
+struct FormatParser<XmlFormat, TCfg> {
+    using type = figcone::xml::Parser;
+};
+
+} //namespace figcone::detail
+#endif
+
+#endif //FIGCONE_XMLREADER_H
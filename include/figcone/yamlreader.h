@@ -0,0 +1,18 @@
+#ifndef FIGCONE_YAMLREADER_H
+#define FIGCONE_YAMLREADER_H
+
+#include "configreadercore.h"
+#include "detail/figcone_yaml_import.h"
+
+#ifdef FIGCONE_YAML_AVAILABLE
+namespace figcone::detail {
+
+template<typename TCfg>
+struct FormatParser<YamlFormat, TCfg> {
+    using type = figcone::yaml::Parser;
+};
+
+} //namespace figcone::detail
+#endif
+
+#endif //FIGCONE_YAMLREADER_H
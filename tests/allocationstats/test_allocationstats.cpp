@@ -0,0 +1,175 @@
+#define FIGCONE_IMPLEMENT_ALLOCATION_COUNTING
+#include <figcone/allocationcounting.h>
+#include <figcone/allocationstatsobserver.h>
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace test_allocationstats {
+
+auto testAllocationCount = figcone::AllocationCount{};
+
+void allocate(std::size_t bytes)
+{
+    ++testAllocationCount.allocations;
+    testAllocationCount.bytes += bytes;
+}
+
+struct Node : public figcone::Config {
+    FIGCONE_PARAM(testInt, int).ensure(
+            [](int)
+            {
+                allocate(10);
+            });
+};
+
+struct ListNode : public figcone::Config {
+    FIGCONE_PARAM(testStr, std::string);
+    FIGCONE_NODE(testNode, Node);
+};
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(testStr, std::string).ensure(
+            [](const std::string&)
+            {
+                allocate(20);
+                allocate(20);
+            });
+    FIGCONE_NODE(testNode, Node);
+    FIGCONE_NODELIST(testNodes, std::vector<ListNode>);
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        allocate(100);
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+std::unique_ptr<figcone::TreeNode> makeTree()
+{
+    ///testStr = Hello
+    ///[testNode]
+    ///  testInt = 1
+    ///[[testNodes]]
+    ///  testStr = Foo
+    ///  [testNodes.testNode]
+    ///    testInt = 2
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("testStr", "Hello", {1, 1});
+    auto& testNode = tree->asItem().addNode("testNode", {2, 1});
+    testNode.asItem().addParam("testInt", "1", {3, 3});
+    auto& testNodes = tree->asItem().addNodeList("testNodes", {4, 1});
+    auto& listNode = testNodes.asList().emplaceBack({4, 1});
+    listNode.asItem().addParam("testStr", "Foo", {5, 3});
+    auto& nestedNode = listNode.asItem().addNode("testNode", {6, 3});
+    nestedNode.asItem().addParam("testInt", "2", {7, 5});
+    return tree;
+}
+
+struct ExpectedStats {
+    figcone::ReadPhase phase;
+    std::string path;
+    std::size_t totalAllocations;
+    std::size_t totalBytes;
+    std::size_t selfAllocations;
+    std::size_t selfBytes;
+};
+
+TEST(TestAllocationStats, PhaseStats)
+{
+    testAllocationCount = {};
+    auto parser = TreeProvider{makeTree()};
+    auto observer = figcone::AllocationStatsObserver{[]
+                                                     {
+                                                         return testAllocationCount;
+                                                     }};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setReadObserver(&observer);
+    cfgReader.read<Cfg>("", parser);
+
+    using figcone::ReadPhase;
+    auto expectedStats = std::vector<ExpectedStats>{
+            {ReadPhase::Parse, "", 1, 100, 1, 100},
+            {ReadPhase::Load, "", 4, 60, 0, 0},
+            {ReadPhase::Node, "testNode", 1, 10, 0, 0},
+            {ReadPhase::Validation, "", 1, 10, 1, 10},
+            {ReadPhase::NodeList, "testNodes", 1, 10, 0, 0},
+            {ReadPhase::NodeListElement, "testNodes[0]", 1, 10, 0, 0},
+            {ReadPhase::Node, "testNodes[0].testNode", 1, 10, 0, 0},
+            {ReadPhase::Validation, "", 1, 10, 1, 10},
+            {ReadPhase::Validation, "", 2, 40, 2, 40},
+            {ReadPhase::PostProcessing, "", 0, 0, 0, 0}};
+    const auto& stats = observer.stats();
+    ASSERT_EQ(stats.size(), expectedStats.size());
+    for (auto i = std::size_t{0}; i < stats.size(); ++i) {
+        EXPECT_EQ(stats[i].phase, expectedStats[i].phase) << i;
+        EXPECT_EQ(stats[i].path, expectedStats[i].path) << i;
+        EXPECT_EQ(stats[i].total.allocations, expectedStats[i].totalAllocations) << i;
+        EXPECT_EQ(stats[i].total.bytes, expectedStats[i].totalBytes) << i;
+        EXPECT_EQ(stats[i].self.allocations, expectedStats[i].selfAllocations) << i;
+        EXPECT_EQ(stats[i].self.bytes, expectedStats[i].selfBytes) << i;
+    }
+}
+
+TEST(TestAllocationStats, ThreadAllocationCount)
+{
+    auto parser = TreeProvider{makeTree()};
+    auto observer = figcone::AllocationStatsObserver{};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setReadObserver(&observer);
+    cfgReader.read<Cfg>("", parser);
+
+    const auto& stats = observer.stats();
+    ASSERT_EQ(stats.size(), 10);
+    const auto& loadStats = stats[1];
+    ASSERT_EQ(loadStats.phase, figcone::ReadPhase::Load);
+    EXPECT_GT(loadStats.total.allocations, 0);
+    EXPECT_GT(loadStats.total.bytes, 0);
+    // nested phases of the load phase are the testNode node, the testNodes node list and the root node validation
+    const auto nestedAllocations = stats[2].total.allocations + stats[4].total.allocations + stats[8].total.allocations;
+    EXPECT_EQ(loadStats.total.allocations - loadStats.self.allocations, nestedAllocations);
+}
+
+TEST(TestAllocationStats, AlignedAndNothrowAllocations)
+{
+    struct alignas(64) AlignedValue {
+        char data[64];
+    };
+
+    const auto startCount = figcone::threadAllocationCount();
+    auto alignedValue = std::make_unique<AlignedValue>();
+    auto nothrowValue = std::unique_ptr<int>{new (std::nothrow) int{1}};
+    const auto count = figcone::threadAllocationCount() - startCount;
+
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(alignedValue.get()) % alignof(AlignedValue), 0);
+    EXPECT_EQ(count.allocations, 2);
+    EXPECT_EQ(count.bytes, sizeof(AlignedValue) + sizeof(int));
+}
+
+TEST(TestAllocationStats, CountingMemoryResource)
+{
+    auto resource = figcone::CountingMemoryResource{};
+    auto values = std::pmr::vector<int>{&resource};
+    values.reserve(16);
+    EXPECT_EQ(resource.count().allocations, 1);
+    EXPECT_EQ(resource.count().bytes, 16 * sizeof(int));
+}
+
+} //namespace test_allocationstats
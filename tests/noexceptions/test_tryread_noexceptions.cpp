@@ -0,0 +1,162 @@
+// Google Test requires exceptions, so this test checks the results of the tryRead* methods without it
+#include <figcone/config.h>
+#include <figcone/configlayer.h>
+#include <figcone/configreader.h>
+#include <figcone/errorreporting.h>
+#include <figcone/errors.h>
+#include <figcone/expected.h>
+#include <figcone_tree/tree.h>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace {
+
+struct Node : public figcone::Config {
+    FIGCONE_PARAM(testInt, int).ensure(
+            [](int value) -> std::optional<std::string>
+            {
+                if (value < 0)
+                    return "value can't be negative";
+                return std::nullopt;
+            });
+};
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(testStr, std::string);
+    FIGCONE_PARAM(testDouble, double)(0.0);
+    FIGCONE_NODE(testNode, Node);
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+private:
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+std::unique_ptr<figcone::TreeNode> makeTree(const std::string& testIntValue)
+{
+    ///testStr = Hello
+    ///[testNode]
+    ///  testInt = <testIntValue>
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("testStr", "Hello", {1, 1});
+    auto& testNode = tree->asItem().addNode("testNode", {2, 1});
+    testNode.asItem().addParam("testInt", testIntValue, {3, 3});
+    return tree;
+}
+
+int failedChecks = 0;
+
+void check(bool condition, const std::string& description)
+{
+    if (condition)
+        return;
+    std::cerr << "Check failed: " << description << std::endl;
+    ++failedChecks;
+}
+
+void testValue()
+{
+    auto parser = TreeProvider{makeTree("10")};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.tryRead<Cfg>("", parser);
+    check(cfg.has_value(), "Value: config is read");
+    if (!cfg)
+        return;
+    check(cfg->testStr == "Hello", "Value: testStr");
+    check(cfg->testNode.testInt == 10, "Value: testNode.testInt");
+}
+
+void testParamError()
+{
+    auto parser = TreeProvider{makeTree("hello")};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.tryRead<Cfg>("", parser);
+    check(!cfg.has_value(), "ParamError: config isn't read");
+    if (cfg)
+        return;
+    check(
+            std::string{cfg.error().what()} ==
+                    "[line:3, column:3] Couldn't set parameter 'testInt' value from 'hello'",
+            "ParamError: error message");
+}
+
+void testValidationErrors()
+{
+    ///testStr = Hello
+    ///[testNode]
+    ///  testInt = -1
+    ///testDouble = hello
+    auto tree = makeTree("-1");
+    tree->asItem().addParam("testDouble", "hello", {4, 1});
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::Original, figcone::ErrorReporting::AllErrors};
+    auto cfg = cfgReader.tryRead<Cfg>("", parser);
+    check(!cfg.has_value(), "ValidationErrors: config isn't read");
+    if (cfg)
+        return;
+    check(cfg.error().errors().size() == 2, "ValidationErrors: number of errors");
+    check(
+            std::string{cfg.error().what()} ==
+                    "[line:3, column:3] Parameter 'testInt': value can't be negative\n"
+                    "[line:4, column:1] Couldn't set parameter 'testDouble' value from 'hello'",
+            "ValidationErrors: error messages");
+}
+
+void testLayers()
+{
+    ///[testNode]
+    ///  testInt = 20
+    auto siteTree = figcone::makeTreeRoot();
+    siteTree->asItem().addNode("testNode", {1, 1}).asItem().addParam("testInt", "20", {2, 3});
+
+    auto defaultsParser = TreeProvider{makeTree("10")};
+    auto siteParser = TreeProvider{std::move(siteTree)};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.tryReadLayers<Cfg>(
+            {figcone::ConfigLayer::fromString("", defaultsParser, "defaults"),
+             figcone::ConfigLayer::fromString("", siteParser, "site")});
+    check(cfg.has_value(), "Layers: config is read");
+    if (!cfg)
+        return;
+    check(cfg->testStr == "Hello", "Layers: testStr");
+    check(cfg->testNode.testInt == 20, "Layers: testNode.testInt");
+}
+
+void testMissingFile()
+{
+    auto parser = TreeProvider{makeTree("10")};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.tryReadFile<Cfg>("missing_config.toml", parser);
+    check(!cfg.has_value(), "MissingFile: config isn't read");
+    if (cfg)
+        return;
+    check(
+            std::string{cfg.error().what()} == "Config file missing_config.toml doesn't exist",
+            "MissingFile: error message");
+}
+
+} //namespace
+
+int main()
+{
+    testValue();
+    testParamError();
+    testValidationErrors();
+    testLayers();
+    testMissingFile();
+    return failedChecks == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,237 @@
+#include "assert_exception.h"
+#include <figcone/commandlineparser.h>
+#include <figcone/config.h>
+#include <figcone/configlayer.h>
+#include <figcone/configreader.h>
+#include <figcone/errors.h>
+#include <figcone/unregisteredfieldhandler.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace test_commandlineparser {
+
+using IntMap = std::map<std::string, int>;
+
+struct DbNode : public figcone::Config {
+    FIGCONE_PARAM(host, std::string)("localhost");
+    FIGCONE_PARAM(poolSize, int);
+};
+
+struct PluginsNode : public figcone::Config {
+    FIGCONE_PARAM(count, int)(0);
+};
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(testStr, std::string);
+    FIGCONE_PARAMLIST(testList, std::vector<int>)();
+    FIGCONE_NODE(db, DbNode);
+    FIGCONE_DICT(testDict, IntMap)();
+};
+
+struct CfgWithPlugins : public figcone::Config {
+    FIGCONE_PARAM(testStr, std::string);
+    FIGCONE_NODE(plugins, PluginsNode)();
+};
+
+} //namespace test_commandlineparser
+
+namespace figcone {
+template<>
+struct UnregisteredFieldHandler<test_commandlineparser::PluginsNode> {
+    void operator()(figcone::FieldType, const std::string&, const figcone::StreamPosition&) {}
+};
+} //namespace figcone
+
+namespace test_commandlineparser {
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+TEST(TestCommandLineParser, Basic)
+{
+    const char* argv[] = {
+            "app",
+            "--test-str=Hello",
+            "--test-list=1",
+            "--test-list",
+            "2",
+            "--db.pool-size=32",
+            "--test-dict.foo=1",
+            "--test-dict.bar=2"};
+
+    auto parser = figcone::CommandLineParser<Cfg>{8, argv, figcone::NameFormat::KebabCase};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::KebabCase};
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.testStr, "Hello");
+    EXPECT_EQ(cfg.testList, (std::vector<int>{1, 2}));
+    EXPECT_EQ(cfg.db.host, "localhost");
+    EXPECT_EQ(cfg.db.poolSize, 32);
+    EXPECT_EQ(cfg.testDict, (IntMap{{"foo", 1}, {"bar", 2}}));
+}
+
+TEST(TestCommandLineParser, OriginalNameFormat)
+{
+    const char* argv[] = {"app", "--testStr=Hello", "--db.poolSize=32", "--db.poolSize=64"};
+
+    auto parser = figcone::CommandLineParser<Cfg>{4, argv};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.testStr, "Hello");
+    EXPECT_EQ(cfg.db.poolSize, 64);
+}
+
+TEST(TestCommandLineParser, Layered)
+{
+    ///testStr = Hello
+    ///testList = [1, 2]
+    ///[db]
+    ///  host = db.local
+    ///  poolSize = 8
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("testStr", "Hello", {1, 1});
+    tree->asItem().addParamList("testList", {"1", "2"}, {2, 1});
+    auto& db = tree->asItem().addNode("db", {3, 1});
+    db.asItem().addParam("host", "db.local", {4, 3});
+    db.asItem().addParam("poolSize", "8", {5, 3});
+
+    const char* argv[] = {"app", "--testList=3", "--db.poolSize=32"};
+
+    auto fileParser = TreeProvider{std::move(tree)};
+    auto commandLineParser = figcone::CommandLineParser<Cfg>{3, argv};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readLayers<Cfg>(
+            {figcone::ConfigLayer::fromString("", fileParser, "config"),
+             figcone::ConfigLayer::fromParser(commandLineParser, "command line")});
+
+    EXPECT_EQ(cfg.testStr, "Hello");
+    EXPECT_EQ(cfg.testList, std::vector<int>{3});
+    EXPECT_EQ(cfg.db.host, "db.local");
+    EXPECT_EQ(cfg.db.poolSize, 32);
+}
+
+TEST(TestCommandLineParser, UnknownFlagError)
+{
+    const char* argv[] = {"app", "--testStr=Hello", "--db.poolSize=32", "--db.timeout=10"};
+
+    auto parser = figcone::CommandLineParser<Cfg>{4, argv};
+    auto cfgReader = figcone::ConfigReader{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.read<Cfg>("", parser);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(std::string{error.what()}, "Unknown param 'timeout'");
+            });
+}
+
+TEST(TestCommandLineParser, UnknownFlagHandler)
+{
+    const char* argv[] = {"app", "--testStr=Hello", "--plugins.foo=1", "--plugins.count=2"};
+
+    auto parser = figcone::CommandLineParser<CfgWithPlugins>{4, argv};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.read<CfgWithPlugins>("", parser);
+
+    EXPECT_EQ(cfg.testStr, "Hello");
+    EXPECT_EQ(cfg.plugins.count, 2);
+}
+
+TEST(TestCommandLineParser, NonFlagArgumentError)
+{
+    const char* argv[] = {"app", "--testStr=Hello", "-v"};
+
+    auto parser = figcone::CommandLineParser<Cfg>{3, argv};
+    auto cfgReader = figcone::ConfigReader{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.read<Cfg>("", parser);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(std::string{error.what()}, "Command line argument '-v' must be a flag starting with '--'");
+            });
+}
+
+TEST(TestCommandLineParser, MissingValueError)
+{
+    const char* argv[] = {"app", "--testStr"};
+
+    auto parser = figcone::CommandLineParser<Cfg>{2, argv};
+    auto cfgReader = figcone::ConfigReader{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.read<Cfg>("", parser);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(std::string{error.what()}, "Command line flag '--testStr' has no value");
+            });
+}
+
+TEST(TestCommandLineParser, MissingValueBeforeNextFlagError)
+{
+    const char* argv[] = {"app", "--testStr", "--db.poolSize=1"};
+
+    auto parser = figcone::CommandLineParser<Cfg>{3, argv};
+    auto cfgReader = figcone::ConfigReader{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.read<Cfg>("", parser);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(std::string{error.what()}, "Command line flag '--testStr' has no value");
+            });
+}
+
+TEST(TestCommandLineParser, ValueStartingWithDashes)
+{
+    const char* argv[] = {"app", "--testStr=--Hello", "--db.poolSize", "-1"};
+
+    auto parser = figcone::CommandLineParser<Cfg>{4, argv};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.read<Cfg>("", parser);
+    EXPECT_EQ(cfg.testStr, "--Hello");
+    EXPECT_EQ(cfg.db.poolSize, -1);
+}
+
+TEST(TestCommandLineParser, InvalidFlagNameError)
+{
+    const char* argv[] = {"app", "--db..poolSize=1"};
+
+    auto parser = figcone::CommandLineParser<Cfg>{2, argv};
+    auto cfgReader = figcone::ConfigReader{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.read<Cfg>("", parser);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(std::string{error.what()}, "Command line flag '--db..poolSize=1' has an invalid name");
+            });
+}
+
+} //namespace test_commandlineparser
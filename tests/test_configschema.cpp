@@ -0,0 +1,83 @@
+#include <figcone/config.h>
+#include <figcone/configschema.h>
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace test_configschema {
+
+using RealMap = std::map<std::string, double>;
+
+struct ServerCfg : public figcone::Config {
+    FIGCONE_PARAM(hostName, std::string);
+    FIGCONE_PARAM(port, int)(80);
+    FIGCONE_PARAMLIST(aliases, std::vector<std::string>)();
+};
+
+struct TreeNodeCfg : public figcone::Config {
+    FIGCONE_PARAM(name, std::string);
+    FIGCONE_NODELIST(children, std::vector<TreeNodeCfg>)();
+};
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(serverName, std::string);
+    FIGCONE_PARAM(maxConnections, figcone::optional<int>);
+    FIGCONE_NODE(mainServer, ServerCfg);
+    FIGCONE_COPY_NODELIST(backupServers, std::vector<ServerCfg>);
+    FIGCONE_DICT(envVars, RealMap);
+    FIGCONE_NODE(tree, figcone::optional<TreeNodeCfg>);
+};
+
+TEST(TestConfigSchema, Fields)
+{
+    const auto schema = figcone::schema<Cfg>();
+
+    struct ExpectedField {
+        std::string_view name;
+        figcone::FieldKind kind;
+        figcone::FieldValueType valueType;
+        bool isOptional;
+        bool isCopyNodeList;
+        std::size_t nestedFieldCount;
+    };
+    auto expectedFields = std::vector<ExpectedField>{
+            {"serverName", figcone::FieldKind::Param, figcone::FieldValueType::String, false, false, 0},
+            {"maxConnections", figcone::FieldKind::Param, figcone::FieldValueType::Integer, true, false, 0},
+            {"mainServer", figcone::FieldKind::Node, figcone::FieldValueType::Other, false, false, 3},
+            {"backupServers", figcone::FieldKind::NodeList, figcone::FieldValueType::Other, false, true, 3},
+            {"envVars", figcone::FieldKind::Dict, figcone::FieldValueType::Real, false, false, 0},
+            {"tree", figcone::FieldKind::Node, figcone::FieldValueType::Other, true, false, 2}};
+    ASSERT_EQ(schema.size(), expectedFields.size());
+    for (auto i = std::size_t{0}; i < schema.size(); ++i) {
+        EXPECT_EQ(schema[i].name, expectedFields[i].name) << i;
+        EXPECT_EQ(schema[i].kind, expectedFields[i].kind) << i;
+        EXPECT_EQ(schema[i].valueType, expectedFields[i].valueType) << i;
+        EXPECT_EQ(schema[i].isOptional, expectedFields[i].isOptional) << i;
+        EXPECT_EQ(schema[i].isCopyNodeList, expectedFields[i].isCopyNodeList) << i;
+        EXPECT_EQ(schema[i].nestedSchema().size(), expectedFields[i].nestedFieldCount) << i;
+    }
+    EXPECT_EQ(schema.find("unknown"), nullptr);
+}
+
+TEST(TestConfigSchema, NameFormat)
+{
+    const auto snakeCaseSchema = figcone::schema<Cfg, figcone::NameFormat::SnakeCase>();
+    ASSERT_NE(snakeCaseSchema.find("main_server"), nullptr);
+    EXPECT_EQ(snakeCaseSchema.find("main_server")->nestedSchema()[0].name, "host_name");
+
+    const auto kebabCaseSchema = figcone::schema<Cfg, figcone::NameFormat::KebabCase>();
+    EXPECT_EQ(kebabCaseSchema[1].name, "max-connections");
+    EXPECT_EQ(kebabCaseSchema[3].nestedSchema()[0].name, "host-name");
+}
+
+TEST(TestConfigSchema, RecursiveNodeList)
+{
+    const auto schema = figcone::schema<TreeNodeCfg>();
+    ASSERT_EQ(schema[1].kind, figcone::FieldKind::NodeList);
+    EXPECT_EQ(schema[1].nestedSchema()[1].nestedSchema()[0].name, "name");
+    EXPECT_EQ(schema[1].nestedSchema().begin(), schema.begin());
+}
+
+} //namespace test_configschema
@@ -0,0 +1,268 @@
+#include "assert_exception.h"
+#include <figcone/config.h>
+#include <figcone/constraints.h>
+#include <figcone/errors.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace test_constraints {
+
+struct Backend : public figcone::Config {
+    FIGCONE_PARAM(name, std::string);
+    FIGCONE_PARAM(host, std::string);
+};
+
+struct Route : public figcone::Config {
+    FIGCONE_PARAM(path, std::string);
+    FIGCONE_PARAM(backend, std::string);
+};
+
+struct Server : public figcone::Config {
+    FIGCONE_PARAM(port, int);
+};
+
+struct Cfg : public figcone::Config {
+    FIGCONE_NODE(server, Server);
+    FIGCONE_NODELIST(backends, std::vector<Backend>);
+    FIGCONE_NODELIST(routes, std::vector<Route>);
+};
+
+Cfg makeCfg()
+{
+    auto cfg = Cfg{};
+    cfg.server.port = 8080;
+    cfg.backends.resize(2);
+    cfg.backends[0].name = "api";
+    cfg.backends[0].host = "10.0.0.1";
+    cfg.backends[1].name = "static";
+    cfg.backends[1].host = "10.0.0.2";
+    cfg.routes.resize(2);
+    cfg.routes[0].path = "/api";
+    cfg.routes[0].backend = "api";
+    cfg.routes[1].path = "/";
+    cfg.routes[1].backend = "static";
+    return cfg;
+}
+
+class ConstraintsFixture : public ::testing::Test {
+protected:
+    ConstraintsFixture()
+    {
+        constraints.add(
+                "routeBackends",
+                {"routes.backend", "backends.name"},
+                [this](const Cfg& cfg) -> std::optional<std::string>
+                {
+                    evaluated.emplace_back("routeBackends");
+                    for (const auto& route : cfg.routes) {
+                        auto hasBackend = std::any_of(
+                                cfg.backends.begin(),
+                                cfg.backends.end(),
+                                [&](const Backend& backend)
+                                {
+                                    return backend.name == route.backend;
+                                });
+                        if (!hasBackend)
+                            return "route '" + route.path + "' uses unknown backend '" + route.backend + "'";
+                    }
+                    return std::nullopt;
+                },
+                {"uniqueBackends"});
+        constraints.add(
+                "uniqueBackends",
+                {"backends.name"},
+                [this](const Cfg& cfg)
+                {
+                    evaluated.emplace_back("uniqueBackends");
+                    for (auto it = cfg.backends.begin(); it != cfg.backends.end(); ++it)
+                        for (auto otherIt = std::next(it); otherIt != cfg.backends.end(); ++otherIt)
+                            if (it->name == otherIt->name)
+                                throw figcone::ValidationError{"backend '" + it->name + "' is declared twice"};
+                });
+        constraints.add(
+                "privilegedPort",
+                {"server.port"},
+                [this](const Cfg& cfg) -> std::optional<std::string>
+                {
+                    evaluated.emplace_back("privilegedPort");
+                    if (cfg.server.port < 1024)
+                        return "port " + std::to_string(cfg.server.port) + " requires elevated privileges";
+                    return std::nullopt;
+                });
+    }
+
+    figcone::Constraints<Cfg> constraints;
+    std::vector<std::string> evaluated;
+};
+
+TEST_F(ConstraintsFixture, Success)
+{
+    auto cfg = makeCfg();
+    EXPECT_FALSE(constraints.tryCheck(cfg).has_value());
+
+    auto expectedEvaluated = std::vector<std::string>{"uniqueBackends", "routeBackends", "privilegedPort"};
+    EXPECT_EQ(evaluated, expectedEvaluated);
+}
+
+TEST_F(ConstraintsFixture, IncrementalCheck)
+{
+    auto cfg = makeCfg();
+    constraints.check(cfg);
+    evaluated.clear();
+
+    constraints.check(cfg);
+    EXPECT_TRUE(evaluated.empty());
+
+    cfg.backends[0].host = "10.0.0.3";
+    constraints.check(cfg);
+    EXPECT_TRUE(evaluated.empty());
+
+    cfg.server.port = 8081;
+    constraints.check(cfg);
+    EXPECT_EQ(evaluated, std::vector<std::string>{"privilegedPort"});
+    evaluated.clear();
+
+    cfg.routes[1].backend = "api";
+    constraints.check(cfg);
+    EXPECT_EQ(evaluated, std::vector<std::string>{"routeBackends"});
+    evaluated.clear();
+
+    constraints.reset();
+    constraints.check(cfg);
+    EXPECT_EQ(evaluated.size(), 3);
+}
+
+TEST_F(ConstraintsFixture, Errors)
+{
+    auto cfg = makeCfg();
+    cfg.routes[1].backend = "images";
+    cfg.server.port = 80;
+
+    auto errors = constraints.tryCheck(cfg);
+    ASSERT_TRUE(errors.has_value());
+    ASSERT_EQ(errors->errors().size(), 2);
+    EXPECT_EQ(errors->errors()[0].message, "Constraint 'routeBackends': route '/' uses unknown backend 'images'");
+    EXPECT_EQ(errors->errors()[1].message, "Constraint 'privilegedPort': port 80 requires elevated privileges");
+    evaluated.clear();
+
+    auto repeatedErrors = constraints.tryCheck(cfg);
+    ASSERT_TRUE(repeatedErrors.has_value());
+    EXPECT_EQ(repeatedErrors->errors().size(), 2);
+    EXPECT_TRUE(evaluated.empty());
+}
+
+TEST_F(ConstraintsFixture, UnsatisfiedPrerequisite)
+{
+    auto cfg = makeCfg();
+    cfg.backends[1].name = "api";
+
+    assert_exception<figcone::ConfigErrorList>(
+            [&]
+            {
+                constraints.check(cfg);
+            },
+            [](const figcone::ConfigErrorList& error)
+            {
+                EXPECT_EQ(std::string{error.what()}, "Constraint 'uniqueBackends': backend 'api' is declared twice");
+            });
+    auto expectedEvaluated = std::vector<std::string>{"uniqueBackends", "privilegedPort"};
+    EXPECT_EQ(evaluated, expectedEvaluated);
+    evaluated.clear();
+
+    cfg.backends[1].name = "static";
+    constraints.check(cfg);
+    expectedEvaluated = std::vector<std::string>{"uniqueBackends", "routeBackends"};
+    EXPECT_EQ(evaluated, expectedEvaluated);
+}
+
+TEST(TestConstraints, WholeConfigDependency)
+{
+    auto evaluationCount = 0;
+    auto constraints = figcone::Constraints<Cfg>{};
+    constraints.add(
+            "notEmpty",
+            {},
+            [&](const Cfg& cfg)
+            {
+                ++evaluationCount;
+                if (cfg.routes.empty())
+                    throw figcone::ValidationError{"routes can't be empty"};
+            });
+
+    auto cfg = makeCfg();
+    constraints.check(cfg);
+    constraints.check(cfg);
+    EXPECT_EQ(evaluationCount, 1);
+
+    cfg.backends[0].host = "10.0.0.3";
+    constraints.check(cfg);
+    EXPECT_EQ(evaluationCount, 2);
+}
+
+TEST(TestConstraints, UnknownFieldError)
+{
+    auto constraints = figcone::Constraints<Cfg>{};
+    auto checkFunc = [](const Cfg&)
+    {
+    };
+    auto expectUnknownField = [&](const std::string& path)
+    {
+        assert_exception<figcone::Error>(
+                [&]
+                {
+                    constraints.add("test", {path}, checkFunc);
+                },
+                [&](const figcone::Error& error)
+                {
+                    EXPECT_EQ(std::string{error.what()}, "Constraint 'test' depends on unknown field '" + path + "'");
+                });
+    };
+    expectUnknownField("server.address");
+    expectUnknownField("server.port.value");
+    expectUnknownField("routes.target");
+    expectUnknownField("routes..path");
+}
+
+TEST(TestConstraints, DuplicateNameError)
+{
+    auto constraints = figcone::Constraints<Cfg>{};
+    auto checkFunc = [](const Cfg&)
+    {
+    };
+    constraints.add("port", {"server.port"}, checkFunc);
+
+    assert_exception<figcone::Error>(
+            [&]
+            {
+                constraints.add("port", {"server"}, checkFunc);
+            },
+            [](const figcone::Error& error)
+            {
+                EXPECT_EQ(std::string{error.what()}, "Constraint 'port' is already added");
+            });
+}
+
+TEST(TestConstraints, PrerequisiteCycleError)
+{
+    auto constraints = figcone::Constraints<Cfg>{};
+    auto checkFunc = [](const Cfg&)
+    {
+    };
+    constraints.add("first", {"server"}, checkFunc, {"second"});
+    constraints.add("second", {"server"}, checkFunc, {"first"});
+
+    assert_exception<figcone::Error>(
+            [&]
+            {
+                constraints.check(makeCfg());
+            },
+            [](const figcone::Error& error)
+            {
+                EXPECT_EQ(std::string{error.what()}, "Constraint prerequisites contain a cycle");
+            });
+}
+
+} //namespace test_constraints
@@ -4,8 +4,15 @@
 #include <figcone/errors.h>
 #include <figcone_tree/tree.h>
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cstddef>
+#include <functional>
 #include <map>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #if __has_include(<figcone/detail/external/nameof.hpp>)
 #define NAMEOF_AVAILABLE
@@ -13,9 +20,99 @@
 
 namespace test_dict {
 
+// Sorted vector map with the part of the std::flat_map interface used by dictionaries
+template<typename TKey, typename TValue, typename TCompare = std::less<>>
+class FlatMap {
+public:
+    using key_type = TKey;
+    using mapped_type = TValue;
+    using value_type = std::pair<TKey, TValue>;
+    using key_compare = TCompare;
+    using iterator = typename std::vector<value_type>::iterator;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+
+    iterator begin()
+    {
+        return elements_.begin();
+    }
+
+    iterator end()
+    {
+        return elements_.end();
+    }
+
+    const_iterator begin() const
+    {
+        return elements_.begin();
+    }
+
+    const_iterator end() const
+    {
+        return elements_.end();
+    }
+
+    std::size_t size() const
+    {
+        return elements_.size();
+    }
+
+    void reserve(std::size_t size)
+    {
+        elements_.reserve(size);
+    }
+
+    key_compare key_comp() const
+    {
+        return {};
+    }
+
+    template<typename TKeyArg, typename TValueArg>
+    iterator emplace_hint(const_iterator hint, TKeyArg&& key, TValueArg&& value)
+    {
+        if (hint != elements_.end() || (!elements_.empty() && !key_comp()(elements_.back().first, key)))
+            ++shiftingInsertionCount_;
+        auto it = std::lower_bound(
+                elements_.begin(),
+                elements_.end(),
+                key,
+                [](const value_type& element, const auto& elementKey)
+                {
+                    return key_compare{}(element.first, elementKey);
+                });
+        return elements_.emplace(it, std::forward<TKeyArg>(key), std::forward<TValueArg>(value));
+    }
+
+    const_iterator find(std::string_view key) const
+    {
+        auto it = std::lower_bound(
+                elements_.begin(),
+                elements_.end(),
+                key,
+                [](const value_type& element, std::string_view elementKey)
+                {
+                    return key_compare{}(element.first, elementKey);
+                });
+        return it != elements_.end() && it->first == key ? it : elements_.end();
+    }
+
+    int shiftingInsertionCount() const
+    {
+        return shiftingInsertionCount_;
+    }
+
+private:
+    std::vector<value_type> elements_;
+    int shiftingInsertionCount_ = 0;
+};
+
 using StringMap = std::map<std::string, std::string>;
 using StringUnorderedMap = std::map<std::string, std::string>;
 using IntMap = std::map<std::string, int>;
+// elements of config trees are usually sorted in ascending order, so the descending order of the map requires
+// sorting them
+using FlatIntMap = FlatMap<std::string, int, std::greater<>>;
+using TransparentIntMap = std::map<std::string, int, std::less<>>;
+using UnorderedIntMap = std::unordered_map<std::string, int>;
 
 struct DictCfg : public figcone::Config {
     FIGCONE_DICT(test, StringMap);
@@ -27,6 +124,12 @@ struct IntDictCfg : public figcone::Config {
     FIGCONE_DICT(test, IntMap)({{"abc", 11}, {"xyz", 12}});
 };
 
+struct MapTypesCfg : public figcone::Config {
+    FIGCONE_DICT(flatMap, FlatIntMap);
+    FIGCONE_DICT(transparentMap, TransparentIntMap);
+    FIGCONE_DICT(unorderedMap, UnorderedIntMap);
+};
+
 struct NonEmptyValidator {
 public:
     template<typename T>
@@ -194,6 +297,48 @@ TEST(TestDict, IntMultiParam)
     EXPECT_EQ(cfg.test["baz"], 777);
 }
 
+TEST(TestDict, MapTypes)
+{
+    ///[flatMap]
+    ///  foo = 1
+    ///  bar = 2
+    ///  baz = 3
+    ///[transparentMap]
+    ///  foo = 4
+    ///  bar = 5
+    ///[unorderedMap]
+    ///  foo = 6
+    ///  bar = 7
+
+    auto tree = figcone::makeTreeRoot();
+    auto& flatMapNode = tree->asItem().addNode("flatMap", {1, 1}).asItem();
+    flatMapNode.addParam("foo", "1", {2, 3});
+    flatMapNode.addParam("bar", "2", {3, 3});
+    flatMapNode.addParam("baz", "3", {4, 3});
+    auto& transparentMapNode = tree->asItem().addNode("transparentMap", {5, 1}).asItem();
+    transparentMapNode.addParam("foo", "4", {6, 3});
+    transparentMapNode.addParam("bar", "5", {7, 3});
+    auto& unorderedMapNode = tree->asItem().addNode("unorderedMap", {8, 1}).asItem();
+    unorderedMapNode.addParam("foo", "6", {9, 3});
+    unorderedMapNode.addParam("bar", "7", {10, 3});
+
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.read<MapTypesCfg>("", parser);
+
+    auto flatMapElements = std::vector<std::pair<std::string, int>>{cfg.flatMap.begin(), cfg.flatMap.end()};
+    EXPECT_EQ(flatMapElements, (std::vector<std::pair<std::string, int>>{{"foo", 1}, {"baz", 3}, {"bar", 2}}));
+    EXPECT_EQ(cfg.flatMap.shiftingInsertionCount(), 0);
+    ASSERT_NE(cfg.flatMap.find(std::string_view{"baz"}), cfg.flatMap.end());
+    EXPECT_EQ(cfg.flatMap.find(std::string_view{"baz"})->second, 3);
+
+    EXPECT_EQ(cfg.transparentMap, (TransparentIntMap{{"foo", 4}, {"bar", 5}}));
+    ASSERT_NE(cfg.transparentMap.find(std::string_view{"foo"}), cfg.transparentMap.end());
+    EXPECT_EQ(cfg.transparentMap.find(std::string_view{"foo"})->second, 4);
+
+    EXPECT_EQ(cfg.unorderedMap, (UnorderedIntMap{{"foo", 6}, {"bar", 7}}));
+}
+
 TEST(TestDict, DefaultValue)
 {
     auto tree = figcone::makeTreeRoot();
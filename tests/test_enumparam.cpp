@@ -0,0 +1,221 @@
+#include "assert_exception.h"
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone/errors.h>
+#include <figcone_tree/stringconverter.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <map>
+#include <optional>
+#include <vector>
+
+#ifdef FIGCONE_NAMEOF_AVAILABLE
+
+namespace test_enumparam {
+
+enum class Color {
+    Red,
+    DarkRed,
+    LightBlue = 10,
+};
+
+enum Level : short {
+    Low = -10,
+    High = 10,
+};
+
+enum class Mode {
+    Foo_Bar,
+    FooBar,
+};
+
+enum class UserEnum {
+    A,
+    B,
+};
+
+} //namespace test_enumparam
+
+template<>
+struct figcone::StringConverter<test_enumparam::UserEnum> {
+    static std::optional<test_enumparam::UserEnum> fromString(const std::string& data)
+    {
+        if (data == "first")
+            return test_enumparam::UserEnum::A;
+        if (data == "second")
+            return test_enumparam::UserEnum::B;
+        return std::nullopt;
+    }
+};
+
+namespace test_enumparam {
+using ColorMap = std::map<std::string, Color>;
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(color, Color);
+    FIGCONE_PARAM(level, Level);
+    FIGCONE_PARAM(optionalColor, figcone::optional<Color>);
+    FIGCONE_PARAMLIST(colors, std::vector<Color>)();
+    FIGCONE_DICT(colorMap, ColorMap)();
+};
+
+struct ModeCfg : public figcone::Config {
+    FIGCONE_PARAM(mode, Mode);
+};
+
+struct UserEnumCfg : public figcone::Config {
+    FIGCONE_PARAM(value, UserEnum);
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+Color readColor(const std::string& value)
+{
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("color", value, {1, 1});
+    tree->asItem().addParam("level", "Low", {2, 1});
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{};
+    return cfgReader.read<Cfg>("", parser).color;
+}
+
+TEST(TestEnumParam, Read)
+{
+    ///color = LightBlue
+    ///level = High
+    ///optionalColor = red
+    ///colors = [Red, dark-red]
+    ///[colorMap]
+    ///  sky = light_blue
+    ///
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("color", "LightBlue", {1, 1});
+    tree->asItem().addParam("level", "High", {2, 1});
+    tree->asItem().addParam("optionalColor", "red", {3, 1});
+    tree->asItem().addParamList("colors", {"Red", "dark-red"}, {4, 1});
+    auto& colorMap = tree->asItem().addNode("colorMap", {5, 1});
+    colorMap.asItem().addParam("sky", "light_blue", {6, 3});
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.color, Color::LightBlue);
+    EXPECT_EQ(cfg.level, High);
+    EXPECT_EQ(cfg.optionalColor, Color::Red);
+    EXPECT_EQ(cfg.colors, (std::vector<Color>{Color::Red, Color::DarkRed}));
+    EXPECT_EQ(cfg.colorMap, (ColorMap{{"sky", Color::LightBlue}}));
+}
+
+TEST(TestEnumParam, NameFormats)
+{
+    EXPECT_EQ(readColor("DarkRed"), Color::DarkRed);
+    EXPECT_EQ(readColor("darkRed"), Color::DarkRed);
+    EXPECT_EQ(readColor("dark_red"), Color::DarkRed);
+    EXPECT_EQ(readColor("dark-red"), Color::DarkRed);
+}
+
+TEST(TestEnumParam, MalformedNameError)
+{
+    for (const auto& name : {"DARK_RED", "darkred", "Dark_Red", "dark_Red", "dark__red", "D_A-R_K_R_E_D"})
+        assert_exception<figcone::ConfigError>(
+                [&]
+                {
+                    readColor(name);
+                },
+                [&](const figcone::ConfigError& error)
+                {
+                    EXPECT_EQ(
+                            std::string{error.what()},
+                            "[line:1, column:1] Couldn't set parameter 'color' value from '" + std::string{name} +
+                                    "'");
+                });
+}
+
+TEST(TestEnumParam, UnknownNameError)
+{
+    ///color = Purple
+    ///level = Low
+    ///
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                readColor("Purple");
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "[line:1, column:1] Couldn't set parameter 'color' value from 'Purple'");
+            });
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                readColor("DarkRed2");
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "[line:1, column:1] Couldn't set parameter 'color' value from 'DarkRed2'");
+            });
+}
+
+TEST(TestEnumParam, SameKeyNames)
+{
+    auto readMode = [](const std::string& value)
+    {
+        auto tree = figcone::makeTreeRoot();
+        tree->asItem().addParam("mode", value, {1, 1});
+        auto parser = TreeProvider{std::move(tree)};
+        auto cfgReader = figcone::ConfigReader{};
+        return cfgReader.read<ModeCfg>("", parser).mode;
+    };
+    EXPECT_EQ(readMode("Foo_Bar"), Mode::Foo_Bar);
+    EXPECT_EQ(readMode("FooBar"), Mode::FooBar);
+    EXPECT_EQ(readMode("foo__bar"), Mode::Foo_Bar);
+    EXPECT_EQ(readMode("foo-bar"), Mode::FooBar);
+
+    ///mode = fooBar
+    ///
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                readMode("fooBar");
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "[line:1, column:1] Couldn't set parameter 'mode' value from 'fooBar'");
+            });
+}
+
+TEST(TestEnumParam, StringConverterSpecialization)
+{
+    ///value = second
+    ///
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("value", "second", {1, 1});
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.read<UserEnumCfg>("", parser);
+
+    EXPECT_EQ(cfg.value, UserEnum::B);
+}
+
+} //namespace test_enumparam
+
+#endif
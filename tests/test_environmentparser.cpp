@@ -0,0 +1,143 @@
+#include "assert_exception.h"
+#include <figcone/config.h>
+#include <figcone/configlayer.h>
+#include <figcone/configreader.h>
+#include <figcone/environmentparser.h>
+#include <figcone/errors.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace test_environmentparser {
+
+using IntMap = std::map<std::string, int>;
+
+struct DbNode : public figcone::Config {
+    FIGCONE_PARAM(host, std::string)("localhost");
+    FIGCONE_PARAM(poolSize, int);
+};
+
+struct Node : public figcone::Config {
+    FIGCONE_PARAM(testInt, int);
+};
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(testStr, std::string);
+    FIGCONE_PARAMLIST(testList, std::vector<int>)();
+    FIGCONE_NODE(db, DbNode);
+    FIGCONE_NODELIST(testNodes, std::vector<Node>)();
+    FIGCONE_DICT(testDict, IntMap)();
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+TEST(TestEnvironmentParser, Basic)
+{
+    const char* environment[] = {
+            "PATH=/usr/bin",
+            "APP_TEST_STR=Hello",
+            "APP_TEST_LIST=1,2,3",
+            "APP_DB__POOL_SIZE=32",
+            "APP_DB__UNKNOWN=1",
+            "OTHER_DB__HOST=remote",
+            nullptr};
+
+    auto parser = figcone::EnvironmentParser<Cfg>{"APP", figcone::NameFormat::Original, environment};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.testStr, "Hello");
+    EXPECT_EQ(cfg.testList, (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(cfg.db.host, "localhost");
+    EXPECT_EQ(cfg.db.poolSize, 32);
+}
+
+TEST(TestEnvironmentParser, NameFormat)
+{
+    const char* environment[] = {"APP_TEST_STR=Hello", "APP_DB__HOST=remote", "APP_DB__POOL_SIZE=32", nullptr};
+
+    auto parser = figcone::EnvironmentParser<Cfg>{"APP", figcone::NameFormat::KebabCase, environment};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::KebabCase};
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.testStr, "Hello");
+    EXPECT_EQ(cfg.db.host, "remote");
+    EXPECT_EQ(cfg.db.poolSize, 32);
+}
+
+TEST(TestEnvironmentParser, EmptyPrefix)
+{
+    const char* environment[] = {"TEST_STR=Hello", "DB__POOL_SIZE=32", nullptr};
+
+    auto parser = figcone::EnvironmentParser<Cfg>{"", figcone::NameFormat::Original, environment};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.testStr, "Hello");
+    EXPECT_EQ(cfg.db.poolSize, 32);
+}
+
+TEST(TestEnvironmentParser, Layered)
+{
+    ///testStr = Hello
+    ///testList = [1, 2]
+    ///[db]
+    ///  host = localhost
+    ///  poolSize = 8
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("testStr", "Hello", {1, 1});
+    tree->asItem().addParamList("testList", {"1", "2"}, {2, 1});
+    auto& db = tree->asItem().addNode("db", {3, 1});
+    db.asItem().addParam("host", "localhost", {4, 3});
+    db.asItem().addParam("poolSize", "8", {5, 3});
+
+    const char* environment[] = {"APP_TEST_LIST=", "APP_DB__POOL_SIZE=32", nullptr};
+
+    auto fileParser = TreeProvider{std::move(tree)};
+    auto environmentParser = figcone::EnvironmentParser<Cfg>{"APP", figcone::NameFormat::Original, environment};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readLayers<Cfg>(
+            {figcone::ConfigLayer::fromString("", fileParser, "config"),
+             figcone::ConfigLayer::fromParser(environmentParser, "environment")});
+
+    EXPECT_EQ(cfg.testStr, "Hello");
+    EXPECT_TRUE(cfg.testList.empty());
+    EXPECT_EQ(cfg.db.host, "localhost");
+    EXPECT_EQ(cfg.db.poolSize, 32);
+}
+
+TEST(TestEnvironmentParser, InvalidValue)
+{
+    const char* environment[] = {"APP_TEST_STR=Hello", "APP_DB__POOL_SIZE=many", nullptr};
+
+    auto parser = figcone::EnvironmentParser<Cfg>{"APP", figcone::NameFormat::Original, environment};
+    auto cfgReader = figcone::ConfigReader{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.readLayers<Cfg>({figcone::ConfigLayer::fromParser(parser, "environment")});
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "Config layer 'environment': Couldn't set parameter 'poolSize' value from 'many'");
+            });
+}
+
+} //namespace test_environmentparser
@@ -0,0 +1,150 @@
+#include "assert_exception.h"
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone/errorreporting.h>
+#include <figcone/errors.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace test_errorreporting {
+
+struct Node : public figcone::Config {
+    FIGCONE_PARAM(testInt, int);
+    FIGCONE_PARAM(testDouble, double)(0.0);
+};
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(testStr, std::string);
+    FIGCONE_PARAM(testUInt, unsigned int)
+            .ensure(
+                    [](unsigned int value)
+                    {
+                        if (value > 10)
+                            throw figcone::ValidationError{"value can't be greater than 10"};
+                    });
+    FIGCONE_NODE(testNode, Node);
+    FIGCONE_NODELIST(testNodes, std::vector<Node>)();
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+std::unique_ptr<figcone::TreeNode> makeInvalidTree()
+{
+    ///testUInt = 11
+    ///testUnknown = 1
+    ///[testNode]
+    ///  testInt = hello
+    ///[[testNodes]]
+    ///  testDouble = 1.0
+    ///[[testNodes]]
+    ///  testInt = 1
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("testUInt", "11", {1, 1});
+    tree->asItem().addParam("testUnknown", "1", {2, 1});
+    auto& testNode = tree->asItem().addNode("testNode", {3, 1});
+    testNode.asItem().addParam("testInt", "hello", {4, 3});
+    auto& testNodes = tree->asItem().addNodeList("testNodes", {6, 1});
+    {
+        auto& node = testNodes.asList().emplaceBack({6, 1});
+        node.asItem().addParam("testDouble", "1.0", {7, 3});
+    }
+    {
+        auto& node = testNodes.asList().emplaceBack({8, 1});
+        node.asItem().addParam("testInt", "1", {9, 3});
+    }
+    return tree;
+}
+
+TEST(TestErrorReporting, FirstError)
+{
+    auto parser = TreeProvider{makeInvalidTree()};
+    auto cfgReader = figcone::ConfigReader{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.read<Cfg>("", parser);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "[line:4, column:3] Couldn't set parameter 'testInt' value from 'hello'");
+            });
+}
+
+TEST(TestErrorReporting, AllErrors)
+{
+    auto parser = TreeProvider{makeInvalidTree()};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::Original, figcone::ErrorReporting::AllErrors};
+    assert_exception<figcone::ConfigErrorList>(
+            [&]
+            {
+                cfgReader.read<Cfg>("", parser);
+            },
+            [](const figcone::ConfigErrorList& error)
+            {
+                const auto& errors = error.errors();
+                ASSERT_EQ(errors.size(), 5);
+                EXPECT_EQ(
+                        errors[0].message,
+                        "[line:1, column:1] Parameter 'testUInt': value can't be greater than 10");
+                EXPECT_EQ(errors[0].position.line, 1);
+                EXPECT_EQ(errors[0].position.column, 1);
+                EXPECT_EQ(errors[1].message, "[line:1, column:1] Root node: Parameter 'testStr' is missing.");
+                EXPECT_EQ(errors[2].message, "[line:2, column:1] Unknown param 'testUnknown'");
+                EXPECT_EQ(
+                        errors[3].message,
+                        "[line:4, column:3] Couldn't set parameter 'testInt' value from 'hello'");
+                EXPECT_EQ(errors[3].position.line, 4);
+                EXPECT_EQ(errors[3].position.column, 3);
+                EXPECT_EQ(
+                        errors[4].message,
+                        "[line:6, column:1] Node list 'testNodes': Parameter 'testInt' is missing.");
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "[line:1, column:1] Parameter 'testUInt': value can't be greater than 10\n"
+                        "[line:1, column:1] Root node: Parameter 'testStr' is missing.\n"
+                        "[line:2, column:1] Unknown param 'testUnknown'\n"
+                        "[line:4, column:3] Couldn't set parameter 'testInt' value from 'hello'\n"
+                        "[line:6, column:1] Node list 'testNodes': Parameter 'testInt' is missing.");
+            });
+}
+
+TEST(TestErrorReporting, AllErrorsValidConfig)
+{
+    ///testStr = Hello
+    ///testUInt = 1
+    ///[testNode]
+    ///  testInt = 2
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("testStr", "Hello", {1, 1});
+    tree->asItem().addParam("testUInt", "1", {2, 1});
+    auto& testNode = tree->asItem().addNode("testNode", {3, 1});
+    testNode.asItem().addParam("testInt", "2", {4, 3});
+
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::Original, figcone::ErrorReporting::AllErrors};
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.testStr, "Hello");
+    EXPECT_EQ(cfg.testUInt, 1);
+    EXPECT_EQ(cfg.testNode.testInt, 2);
+    EXPECT_TRUE(cfg.testNodes.empty());
+}
+
+} //namespace test_errorreporting
@@ -0,0 +1,302 @@
+#include "assert_exception.h"
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone/fingerprint.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <map>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace test_fingerprint {
+
+using IntMap = std::map<std::string, int>;
+using StringUnorderedMap = std::unordered_map<std::string, std::string>;
+
+struct Node : public figcone::Config {
+    FIGCONE_PARAM(testInt, int);
+    FIGCONE_PARAM(testString, std::string)();
+};
+
+struct NonAggregateNode : public figcone::Config {
+    using Config::Config;
+    virtual ~NonAggregateNode() = default;
+    FIGCONE_PARAM(testDouble, double);
+};
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(foo, int);
+    FIGCONE_PARAM(bar, figcone::optional<std::string>);
+    FIGCONE_PARAMLIST(testList, std::vector<int>);
+    FIGCONE_NODE(testNode, Node);
+    FIGCONE_NODE(optTestNode, figcone::optional<NonAggregateNode>);
+    FIGCONE_NODELIST(testNodes, std::vector<Node>);
+    FIGCONE_DICT(testDict, IntMap);
+    FIGCONE_DICT(testUnorderedDict, StringUnorderedMap);
+};
+
+struct Version {
+    int major = 0;
+    int minor = 0;
+
+    bool operator==(const Version& other) const
+    {
+        return major == other.major && minor == other.minor;
+    }
+};
+
+} //namespace test_fingerprint
+
+template<>
+struct figcone::StringConverter<test_fingerprint::Version> {
+    static std::optional<test_fingerprint::Version> fromString(const std::string& data)
+    {
+        return test_fingerprint::Version{std::stoi(data), 0};
+    }
+};
+
+namespace test_fingerprint {
+
+struct VersionCfg : public figcone::Config {
+    FIGCONE_PARAM(name, std::string);
+    FIGCONE_PARAM(version, Version);
+};
+
+struct DerivedNode : public Node {
+    FIGCONE_PARAM(testFlag, bool);
+};
+
+struct CfgWithoutMacro : public figcone::Config {
+    FIGCONE_PARAM(foo, int);
+    int bar = param<&CfgWithoutMacro::bar>("bar");
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+Cfg makeCfg()
+{
+    auto cfg = Cfg{};
+    cfg.foo = 1;
+    cfg.bar = "test";
+    cfg.testList = {1, 2, 3};
+    cfg.testNode.testInt = 10;
+    cfg.testNode.testString = "Hello world";
+    cfg.testNodes.resize(2);
+    cfg.testNodes[0].testInt = 100;
+    cfg.testNodes[1].testInt = 200;
+    cfg.testDict = {{"a", 1}, {"b", 2}};
+    for (auto i = 0; i < 32; ++i)
+        cfg.testUnorderedDict.emplace("key" + std::to_string(i), std::to_string(i));
+    return cfg;
+}
+
+TEST(TestFingerprint, EqualConfigs)
+{
+    auto cfg = makeCfg();
+    auto cfg2 = makeCfg();
+    EXPECT_TRUE(figcone::equal(cfg, cfg2));
+    EXPECT_EQ(figcone::fingerprint(cfg), figcone::fingerprint(cfg2));
+}
+
+TEST(TestFingerprint, UnorderedDictInsertionOrderDoesntMatter)
+{
+    auto cfg = makeCfg();
+    auto cfg2 = makeCfg();
+    cfg2.testUnorderedDict.clear();
+    cfg2.testUnorderedDict.rehash(1024);
+    for (auto i = 31; i >= 0; --i)
+        cfg2.testUnorderedDict.emplace("key" + std::to_string(i), std::to_string(i));
+    EXPECT_TRUE(figcone::equal(cfg, cfg2));
+    EXPECT_EQ(figcone::fingerprint(cfg), figcone::fingerprint(cfg2));
+}
+
+TEST(TestFingerprint, ModifiedParam)
+{
+    auto cfg = makeCfg();
+    auto cfg2 = makeCfg();
+    cfg2.foo = 2;
+    EXPECT_FALSE(figcone::equal(cfg, cfg2));
+    EXPECT_NE(figcone::fingerprint(cfg), figcone::fingerprint(cfg2));
+}
+
+TEST(TestFingerprint, ModifiedOptionalParam)
+{
+    auto cfg = makeCfg();
+    auto cfg2 = makeCfg();
+    cfg2.bar = std::nullopt;
+    EXPECT_FALSE(figcone::equal(cfg, cfg2));
+    EXPECT_NE(figcone::fingerprint(cfg), figcone::fingerprint(cfg2));
+}
+
+TEST(TestFingerprint, ModifiedParamList)
+{
+    auto cfg = makeCfg();
+    auto cfg2 = makeCfg();
+    cfg2.testList.push_back(4);
+    EXPECT_FALSE(figcone::equal(cfg, cfg2));
+    EXPECT_NE(figcone::fingerprint(cfg), figcone::fingerprint(cfg2));
+}
+
+TEST(TestFingerprint, ModifiedNode)
+{
+    auto cfg = makeCfg();
+    auto cfg2 = makeCfg();
+    cfg2.testNode.testString = "Hello";
+    EXPECT_FALSE(figcone::equal(cfg, cfg2));
+    EXPECT_NE(figcone::fingerprint(cfg), figcone::fingerprint(cfg2));
+}
+
+TEST(TestFingerprint, ModifiedOptionalNode)
+{
+    auto cfg = makeCfg();
+    auto cfg2 = makeCfg();
+    cfg2.optTestNode.emplace();
+    cfg2.optTestNode->testDouble = 0.5;
+    EXPECT_FALSE(figcone::equal(cfg, cfg2));
+    EXPECT_NE(figcone::fingerprint(cfg), figcone::fingerprint(cfg2));
+
+    cfg.optTestNode.emplace();
+    cfg.optTestNode->testDouble = 0.5;
+    EXPECT_TRUE(figcone::equal(cfg, cfg2));
+    EXPECT_EQ(figcone::fingerprint(cfg), figcone::fingerprint(cfg2));
+}
+
+TEST(TestFingerprint, ModifiedNodeList)
+{
+    auto cfg = makeCfg();
+    auto cfg2 = makeCfg();
+    cfg2.testNodes[1].testInt = 201;
+    EXPECT_FALSE(figcone::equal(cfg, cfg2));
+    EXPECT_NE(figcone::fingerprint(cfg), figcone::fingerprint(cfg2));
+}
+
+TEST(TestFingerprint, ModifiedDict)
+{
+    auto cfg = makeCfg();
+    auto cfg2 = makeCfg();
+    cfg2.testUnorderedDict["key0"] = "0!";
+    EXPECT_FALSE(figcone::equal(cfg, cfg2));
+    EXPECT_NE(figcone::fingerprint(cfg), figcone::fingerprint(cfg2));
+}
+
+TEST(TestFingerprint, NodeSection)
+{
+    auto cfg = makeCfg();
+    auto cfg2 = makeCfg();
+    cfg2.foo = 2;
+    EXPECT_TRUE(figcone::equal(cfg.testNode, cfg2.testNode));
+    EXPECT_EQ(figcone::fingerprint(cfg.testNode), figcone::fingerprint(cfg2.testNode));
+}
+
+TEST(TestFingerprint, StableValue)
+{
+    auto cfg = Node{};
+    cfg.testInt = 1;
+    cfg.testString = "test";
+    EXPECT_EQ(figcone::fingerprint(cfg), 0x5f1f7c75dd96a0a4ULL);
+}
+
+TEST(TestFingerprint, ReadConfigs)
+{
+    ///foo = 1
+    ///testList = [1, 2, 3]
+    ///[testNode]
+    ///  testInt = 10
+    ///[[testNodes]]
+    ///  testInt = 100
+    ///[testDict]
+    ///  a = 1
+    ///[testUnorderedDict]
+    ///
+    auto makeTreeProvider = [](const std::string& testIntValue)
+    {
+        auto tree = figcone::makeTreeRoot();
+        tree->asItem().addParam("foo", "1", {1, 1});
+        tree->asItem().addParamList("testList", std::vector<std::string>{"1", "2", "3"}, {2, 1});
+        auto& testNode = tree->asItem().addNode("testNode", {3, 1});
+        testNode.asItem().addParam("testInt", "10", {4, 3});
+        auto& testNodes = tree->asItem().addNodeList("testNodes", {5, 1});
+        testNodes.asList().emplaceBack({5, 1}).asItem().addParam("testInt", testIntValue, {6, 3});
+        tree->asItem().addNode("testDict", {7, 1}).asItem().addParam("a", "1", {8, 3});
+        tree->asItem().addNode("testUnorderedDict", {9, 1});
+        return TreeProvider{std::move(tree)};
+    };
+
+    auto cfgReader = figcone::ConfigReader{};
+    auto parser = makeTreeProvider("100");
+    auto cfg = cfgReader.read<Cfg>("", parser);
+    auto parser2 = makeTreeProvider("100");
+    auto cfg2 = cfgReader.read<Cfg>("", parser2);
+    auto parser3 = makeTreeProvider("101");
+    auto cfg3 = cfgReader.read<Cfg>("", parser3);
+
+    EXPECT_TRUE(figcone::equal(cfg, cfg2));
+    EXPECT_EQ(figcone::fingerprint(cfg), figcone::fingerprint(cfg2));
+    EXPECT_FALSE(figcone::equal(cfg, cfg3));
+    EXPECT_NE(figcone::fingerprint(cfg), figcone::fingerprint(cfg3));
+}
+
+TEST(TestFingerprint, ParamTypeNotWritableToStream)
+{
+    auto cfg = VersionCfg{};
+    cfg.version = Version{1, 2};
+    auto cfg2 = VersionCfg{};
+    cfg2.version = Version{1, 3};
+    EXPECT_FALSE(figcone::equal(cfg, cfg2));
+    cfg2.version = Version{1, 2};
+    EXPECT_TRUE(figcone::equal(cfg, cfg2));
+}
+
+TEST(TestFingerprint, DerivedConfig)
+{
+    auto cfg = DerivedNode{};
+    cfg.testInt = 1;
+    cfg.testString = "test";
+    cfg.testFlag = true;
+    auto cfg2 = cfg;
+    EXPECT_TRUE(figcone::equal(cfg, cfg2));
+    EXPECT_EQ(figcone::fingerprint(cfg), figcone::fingerprint(cfg2));
+
+    cfg2.testInt = 2;
+    EXPECT_FALSE(figcone::equal(cfg, cfg2));
+    EXPECT_NE(figcone::fingerprint(cfg), figcone::fingerprint(cfg2));
+
+    cfg2 = cfg;
+    cfg2.testFlag = false;
+    EXPECT_FALSE(figcone::equal(cfg, cfg2));
+    EXPECT_NE(figcone::fingerprint(cfg), figcone::fingerprint(cfg2));
+}
+
+TEST(TestFingerprint, FieldsWithoutMacros)
+{
+    auto cfg = CfgWithoutMacro{};
+    assert_exception<figcone::Error>(
+            [&]
+            {
+                figcone::fingerprint(cfg);
+            },
+            [](const figcone::Error& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "Fields of runtime reflection configs must be declared with FIGCONE_* macros to be used in "
+                        "fingerprint(), equal(), footprint(), constraints and the config schema");
+            });
+}
+
+} //namespace test_fingerprint
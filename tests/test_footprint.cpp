@@ -0,0 +1,164 @@
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone/footprint.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace test_footprint {
+
+using StringMap = std::map<std::string, std::string>;
+
+struct Node : public figcone::Config {
+    FIGCONE_PARAM(testStr, std::string);
+    FIGCONE_PARAMLIST(testList, std::vector<int>);
+};
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(name, std::string);
+    FIGCONE_PARAM(optName, figcone::optional<std::string>);
+    FIGCONE_PARAMLIST(values, std::vector<int>);
+    FIGCONE_NODE(testNode, Node);
+    FIGCONE_NODELIST(testNodes, std::vector<Node>);
+    FIGCONE_DICT(testDict, StringMap);
+};
+
+Cfg makeCfg()
+{
+    auto cfg = Cfg{};
+    cfg.name = std::string(100, 'x');
+    cfg.values.reserve(1000);
+    cfg.values = {1, 2, 3};
+    cfg.testNode.testStr = std::string(50, 'y');
+    cfg.testNode.testList = {1, 2};
+    cfg.testNodes.resize(2);
+    cfg.testNodes[0].testStr = std::string(200, 'z');
+    cfg.testNodes[1].testList = {1, 2, 3, 4};
+    cfg.testDict = {{"a", "1"}, {"b", "2"}};
+    return cfg;
+}
+
+const figcone::FieldFootprint& findField(const figcone::ConfigFootprint& footprint, const std::string& path)
+{
+    auto it = std::find_if(
+            footprint.fields.begin(),
+            footprint.fields.end(),
+            [&](const figcone::FieldFootprint& field)
+            {
+                return field.path == path;
+            });
+    if (it == footprint.fields.end())
+        throw std::runtime_error{"Field " + path + " isn't found"};
+    return *it;
+}
+
+std::size_t stringHeapBytes(const std::string& str)
+{
+    return str.capacity() > std::string{}.capacity() ? str.capacity() + 1 : 0;
+}
+
+TEST(TestFootprint, FieldPaths)
+{
+    auto cfg = makeCfg();
+    auto footprint = figcone::footprint(cfg);
+    auto paths = std::vector<std::string>{};
+    for (const auto& field : footprint.fields)
+        paths.push_back(field.path);
+    std::sort(paths.begin(), paths.end());
+
+    auto expectedPaths = std::vector<std::string>{
+            "name",
+            "optName",
+            "testDict",
+            "testNode",
+            "testNode.testList",
+            "testNode.testStr",
+            "testNodes",
+            "testNodes.testList",
+            "testNodes.testStr",
+            "values"};
+    EXPECT_EQ(paths, expectedPaths);
+}
+
+TEST(TestFootprint, SortedBreakdown)
+{
+    auto cfg = makeCfg();
+    auto footprint = figcone::footprint(cfg);
+    EXPECT_TRUE(std::is_sorted(
+            footprint.fields.begin(),
+            footprint.fields.end(),
+            [](const figcone::FieldFootprint& lhs, const figcone::FieldFootprint& rhs)
+            {
+                return lhs.size + lhs.heapBytes > rhs.size + rhs.heapBytes;
+            }));
+    EXPECT_EQ(footprint.fields.front().path, "values");
+}
+
+TEST(TestFootprint, HeapBytes)
+{
+    auto cfg = makeCfg();
+    auto footprint = figcone::footprint(cfg);
+    EXPECT_EQ(footprint.size, sizeof(Cfg));
+
+    const auto& name = findField(footprint, "name");
+    EXPECT_EQ(name.size, sizeof(std::string));
+    EXPECT_EQ(name.heapBytes, stringHeapBytes(cfg.name));
+    EXPECT_FALSE(name.hasWastedCapacity);
+
+    const auto& optName = findField(footprint, "optName");
+    EXPECT_EQ(optName.size, sizeof(figcone::optional<std::string>));
+    EXPECT_EQ(optName.heapBytes, 0);
+
+    const auto& testNodeStr = findField(footprint, "testNode.testStr");
+    const auto& testNodeList = findField(footprint, "testNode.testList");
+    const auto& testNode = findField(footprint, "testNode");
+    EXPECT_EQ(testNode.size, sizeof(Node));
+    EXPECT_EQ(testNodeStr.heapBytes, stringHeapBytes(cfg.testNode.testStr));
+    EXPECT_EQ(testNodeList.heapBytes, cfg.testNode.testList.capacity() * sizeof(int));
+    EXPECT_EQ(testNode.heapBytes, testNodeStr.heapBytes + testNodeList.heapBytes);
+
+    auto totalHeapBytes = std::size_t{};
+    for (const auto& field : footprint.fields)
+        if (field.path.find('.') == std::string::npos)
+            totalHeapBytes += field.heapBytes;
+    EXPECT_EQ(footprint.heapBytes, totalHeapBytes);
+}
+
+TEST(TestFootprint, NodeListFieldsAreCombined)
+{
+    auto cfg = makeCfg();
+    auto footprint = figcone::footprint(cfg);
+
+    const auto& testNodesStr = findField(footprint, "testNodes.testStr");
+    EXPECT_EQ(testNodesStr.size, 2 * sizeof(std::string));
+    EXPECT_EQ(testNodesStr.heapBytes, stringHeapBytes(cfg.testNodes[0].testStr));
+
+    const auto& testNodesList = findField(footprint, "testNodes.testList");
+    EXPECT_EQ(testNodesList.size, 2 * sizeof(std::vector<int>));
+    EXPECT_EQ(testNodesList.heapBytes, cfg.testNodes[1].testList.capacity() * sizeof(int));
+
+    const auto& testNodes = findField(footprint, "testNodes");
+    EXPECT_EQ(
+            testNodes.heapBytes,
+            cfg.testNodes.capacity() * sizeof(Node) + testNodesStr.heapBytes + testNodesList.heapBytes);
+}
+
+TEST(TestFootprint, WastedCapacity)
+{
+    auto cfg = makeCfg();
+    auto footprint = figcone::footprint(cfg);
+
+    const auto& values = findField(footprint, "values");
+    EXPECT_EQ(values.heapBytes, cfg.values.capacity() * sizeof(int));
+    EXPECT_EQ(values.unusedCapacityBytes, (cfg.values.capacity() - 3) * sizeof(int));
+    EXPECT_TRUE(values.hasWastedCapacity);
+
+    cfg.values.shrink_to_fit();
+    footprint = figcone::footprint(cfg);
+    EXPECT_FALSE(findField(footprint, "values").hasWastedCapacity);
+}
+
+} //namespace test_footprint
@@ -0,0 +1,113 @@
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone/fingerprint.h>
+#include <figcone/internedstring.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace test_internedstring {
+
+struct BackendCfg : public figcone::Config {
+    FIGCONE_PARAM(name, std::string);
+    FIGCONE_PARAM(region, figcone::InternedString);
+    FIGCONE_PARAMLIST(tags, std::vector<figcone::InternedString>)();
+};
+
+struct Cfg : public figcone::Config {
+    FIGCONE_NODELIST(backends, std::vector<BackendCfg>);
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+TEST(TestInternedString, Read)
+{
+    ///[[backends]]
+    ///  name = backend_0
+    ///  region = test-internedstring-region-eu
+    ///  tags = [test-internedstring-tag, test-internedstring-region-eu]
+    ///[[backends]]
+    ///  name = backend_1
+    ///  region = test-internedstring-region-eu
+    ///[[backends]]
+    ///  name = backend_2
+    ///  region = test-internedstring-region-us
+    auto tree = figcone::makeTreeRoot();
+    auto& backends = tree->asItem().addNodeList("backends", {1, 1});
+    auto regions = std::vector<std::string>{
+            "test-internedstring-region-eu",
+            "test-internedstring-region-eu",
+            "test-internedstring-region-us"};
+    for (auto i = 0; i < 3; ++i) {
+        auto& backend = backends.asList().emplaceBack({1, 1});
+        backend.asItem().addParam("name", "backend_" + std::to_string(i), {2, 3});
+        backend.asItem().addParam("region", regions[i], {3, 3});
+        if (i == 0)
+            backend.asItem().addParamList(
+                    "tags",
+                    {"test-internedstring-tag", "test-internedstring-region-eu"},
+                    {4, 3});
+    }
+    const auto internedCount = figcone::internedStringCount();
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    ASSERT_EQ(cfg.backends.size(), 3);
+    EXPECT_EQ(cfg.backends[0].region.str(), "test-internedstring-region-eu");
+    EXPECT_EQ(cfg.backends[2].region.str(), "test-internedstring-region-us");
+    EXPECT_EQ(cfg.backends[0].region, cfg.backends[1].region);
+    EXPECT_NE(cfg.backends[0].region, cfg.backends[2].region);
+    EXPECT_EQ(cfg.backends[0].region.c_str(), cfg.backends[1].region.c_str());
+    ASSERT_EQ(cfg.backends[0].tags.size(), 2);
+    EXPECT_EQ(cfg.backends[0].tags[1].c_str(), cfg.backends[0].region.c_str());
+    EXPECT_EQ(figcone::internedStringCount(), internedCount + 3);
+}
+
+TEST(TestInternedString, Value)
+{
+    auto value = figcone::InternedString{"test-internedstring-value"};
+    auto sameValue = figcone::InternedString{std::string{"test-internedstring-value"}};
+    EXPECT_EQ(value, sameValue);
+    EXPECT_EQ(&value.str(), &sameValue.str());
+    EXPECT_EQ(std::string_view{value}, "test-internedstring-value");
+    EXPECT_EQ(value.size(), 25);
+    EXPECT_TRUE(value < figcone::InternedString{"test-internedstring-value2"});
+
+    EXPECT_TRUE(figcone::InternedString{}.empty());
+    EXPECT_EQ(figcone::InternedString{}, figcone::InternedString{""});
+
+    auto values = std::unordered_set<figcone::InternedString>{value, sameValue, figcone::InternedString{}};
+    EXPECT_EQ(values.size(), 2);
+}
+
+TEST(TestInternedString, Fingerprint)
+{
+    auto backend = BackendCfg{};
+    backend.name = "backend";
+    backend.region = figcone::InternedString{"test-internedstring-fingerprint"};
+    auto backend2 = backend;
+    EXPECT_TRUE(figcone::equal(backend, backend2));
+    EXPECT_EQ(figcone::fingerprint(backend), figcone::fingerprint(backend2));
+
+    backend2.region = figcone::InternedString{"test-internedstring-fingerprint2"};
+    EXPECT_FALSE(figcone::equal(backend, backend2));
+    EXPECT_NE(figcone::fingerprint(backend), figcone::fingerprint(backend2));
+}
+
+} //namespace test_internedstring
@@ -0,0 +1,357 @@
+#include "assert_exception.h"
+#include <figcone/config.h>
+#include <figcone/configlayer.h>
+#include <figcone/configreader.h>
+#include <figcone/errors.h>
+#include <figcone/parallelvalidation.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace test_layers {
+
+using IntMap = std::map<std::string, int>;
+
+struct Node : public figcone::Config {
+    FIGCONE_PARAM(testInt, int);
+    FIGCONE_PARAM(testString, std::string)("default");
+};
+
+struct ValidatedNode : public figcone::Config {
+    FIGCONE_PARAM(testInt, int).ensure(
+            [](int value)
+            {
+                if (value < 0)
+                    throw figcone::ValidationError{"value can't be negative"};
+            });
+};
+
+struct ValidatedCfg : public figcone::Config {
+    FIGCONE_NODE(testNode, ValidatedNode);
+};
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(testStr, std::string);
+    FIGCONE_PARAMLIST(testList, std::vector<int>)();
+    FIGCONE_NODE(testNode, Node);
+    FIGCONE_NODELIST(testNodes, std::vector<Node>)();
+    FIGCONE_DICT(testDict, IntMap)();
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+TEST(TestLayers, ParamsAreReplaced)
+{
+    ///testStr = Hello
+    ///testList = [1, 2]
+    ///[testNode]
+    ///  testInt = 1
+    auto defaultsTree = figcone::makeTreeRoot();
+    defaultsTree->asItem().addParam("testStr", "Hello", {1, 1});
+    defaultsTree->asItem().addParamList("testList", {"1", "2"}, {2, 1});
+    auto& defaultsNode = defaultsTree->asItem().addNode("testNode", {3, 1});
+    defaultsNode.asItem().addParam("testInt", "1", {4, 3});
+
+    ///testList = [3]
+    ///[testNode]
+    ///  testInt = 2
+    auto siteTree = figcone::makeTreeRoot();
+    siteTree->asItem().addParamList("testList", {"3"}, {1, 1});
+    auto& siteNode = siteTree->asItem().addNode("testNode", {2, 1});
+    siteNode.asItem().addParam("testInt", "2", {3, 3});
+
+    auto defaultsParser = TreeProvider{std::move(defaultsTree)};
+    auto siteParser = TreeProvider{std::move(siteTree)};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readLayers<Cfg>(
+            {figcone::ConfigLayer::fromString("", defaultsParser, "defaults"),
+             figcone::ConfigLayer::fromString("", siteParser, "site")});
+
+    EXPECT_EQ(cfg.testStr, "Hello");
+    EXPECT_EQ(cfg.testList, std::vector<int>{3});
+    EXPECT_EQ(cfg.testNode.testInt, 2);
+    EXPECT_EQ(cfg.testNode.testString, "default");
+}
+
+TEST(TestLayers, NodesAndDictsAreMerged)
+{
+    ///testStr = Hello
+    ///[testNode]
+    ///  testInt = 1
+    ///[testDict]
+    ///  foo = 1
+    ///  bar = 2
+    auto defaultsTree = figcone::makeTreeRoot();
+    defaultsTree->asItem().addParam("testStr", "Hello", {1, 1});
+    auto& defaultsNode = defaultsTree->asItem().addNode("testNode", {2, 1});
+    defaultsNode.asItem().addParam("testInt", "1", {3, 3});
+    auto& defaultsDict = defaultsTree->asItem().addNode("testDict", {4, 1});
+    defaultsDict.asItem().addParam("foo", "1", {5, 3});
+    defaultsDict.asItem().addParam("bar", "2", {6, 3});
+
+    ///[testNode]
+    ///  testString = site
+    ///[testDict]
+    ///  bar = 20
+    ///  baz = 30
+    auto siteTree = figcone::makeTreeRoot();
+    auto& siteNode = siteTree->asItem().addNode("testNode", {1, 1});
+    siteNode.asItem().addParam("testString", "site", {2, 3});
+    auto& siteDict = siteTree->asItem().addNode("testDict", {3, 1});
+    siteDict.asItem().addParam("bar", "20", {4, 3});
+    siteDict.asItem().addParam("baz", "30", {5, 3});
+
+    auto defaultsParser = TreeProvider{std::move(defaultsTree)};
+    auto siteParser = TreeProvider{std::move(siteTree)};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readLayers<Cfg>(
+            {figcone::ConfigLayer::fromString("", defaultsParser, "defaults"),
+             figcone::ConfigLayer::fromString("", siteParser, "site")});
+
+    EXPECT_EQ(cfg.testStr, "Hello");
+    EXPECT_EQ(cfg.testNode.testInt, 1);
+    EXPECT_EQ(cfg.testNode.testString, "site");
+    EXPECT_EQ(cfg.testDict, (IntMap{{"foo", 1}, {"bar", 20}, {"baz", 30}}));
+}
+
+TEST(TestLayers, NodeListsAreReplaced)
+{
+    ///testStr = Hello
+    ///[[testNodes]]
+    ///  testInt = 1
+    ///[[testNodes]]
+    ///  testInt = 2
+    auto defaultsTree = figcone::makeTreeRoot();
+    defaultsTree->asItem().addParam("testStr", "Hello", {1, 1});
+    auto& defaultsNodes = defaultsTree->asItem().addNodeList("testNodes", {2, 1});
+    {
+        auto& node = defaultsNodes.asList().emplaceBack({2, 1});
+        node.asItem().addParam("testInt", "1", {3, 3});
+    }
+    {
+        auto& node = defaultsNodes.asList().emplaceBack({4, 1});
+        node.asItem().addParam("testInt", "2", {5, 3});
+    }
+    auto& defaultsNode = defaultsTree->asItem().addNode("testNode", {6, 1});
+    defaultsNode.asItem().addParam("testInt", "0", {7, 3});
+
+    ///[[testNodes]]
+    ///  testInt = 3
+    ///  testString = site
+    auto siteTree = figcone::makeTreeRoot();
+    auto& siteNodes = siteTree->asItem().addNodeList("testNodes", {1, 1});
+    {
+        auto& node = siteNodes.asList().emplaceBack({1, 1});
+        node.asItem().addParam("testInt", "3", {2, 3});
+        node.asItem().addParam("testString", "site", {3, 3});
+    }
+
+    auto defaultsParser = TreeProvider{std::move(defaultsTree)};
+    auto siteParser = TreeProvider{std::move(siteTree)};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readLayers<Cfg>(
+            {figcone::ConfigLayer::fromString("", defaultsParser, "defaults"),
+             figcone::ConfigLayer::fromString("", siteParser, "site")});
+
+    ASSERT_EQ(cfg.testNodes.size(), 1);
+    EXPECT_EQ(cfg.testNodes[0].testInt, 3);
+    EXPECT_EQ(cfg.testNodes[0].testString, "site");
+}
+
+TEST(TestLayers, ParamErrorReportsLayer)
+{
+    ///testStr = Hello
+    ///[testNode]
+    ///  testInt = 1
+    auto defaultsTree = figcone::makeTreeRoot();
+    defaultsTree->asItem().addParam("testStr", "Hello", {1, 1});
+    auto& defaultsNode = defaultsTree->asItem().addNode("testNode", {2, 1});
+    defaultsNode.asItem().addParam("testInt", "1", {3, 3});
+
+    ///[testNode]
+    ///  testInt = hello
+    auto siteTree = figcone::makeTreeRoot();
+    auto& siteNode = siteTree->asItem().addNode("testNode", {1, 1});
+    siteNode.asItem().addParam("testInt", "hello", {2, 3});
+
+    auto defaultsParser = TreeProvider{std::move(defaultsTree)};
+    auto siteParser = TreeProvider{std::move(siteTree)};
+    auto cfgReader = figcone::ConfigReader{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.readLayers<Cfg>(
+                        {figcone::ConfigLayer::fromString("", defaultsParser, "defaults"),
+                         figcone::ConfigLayer::fromString("", siteParser, "site")});
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "Config layer 'site': [line:2, column:3] Couldn't set parameter 'testInt' value from 'hello'");
+            });
+}
+
+TEST(TestLayers, MissingParamError)
+{
+    ///[testNode]
+    ///  testInt = 1
+    auto defaultsTree = figcone::makeTreeRoot();
+    auto& defaultsNode = defaultsTree->asItem().addNode("testNode", {1, 1});
+    defaultsNode.asItem().addParam("testInt", "1", {2, 3});
+
+    auto defaultsParser = TreeProvider{std::move(defaultsTree)};
+    auto cfgReader = figcone::ConfigReader{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.readLayers<Cfg>({figcone::ConfigLayer::fromString("", defaultsParser, "defaults")});
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "Config layer 'defaults': [line:1, column:1] Root node: Parameter 'testStr' is missing.");
+            });
+}
+
+TEST(TestLayers, MissingNodeParamErrorReportsMergedLayers)
+{
+    ///testStr = Hello
+    ///[testNode]
+    ///  testString = Hello
+    auto defaultsTree = figcone::makeTreeRoot();
+    defaultsTree->asItem().addParam("testStr", "Hello", {1, 1});
+    auto& defaultsNode = defaultsTree->asItem().addNode("testNode", {2, 1});
+    defaultsNode.asItem().addParam("testString", "Hello", {3, 3});
+
+    ///[testNode]
+    ///  testString = world
+    auto siteTree = figcone::makeTreeRoot();
+    auto& siteNode = siteTree->asItem().addNode("testNode", {1, 1});
+    siteNode.asItem().addParam("testString", "world", {2, 3});
+
+    auto defaultsParser = TreeProvider{std::move(defaultsTree)};
+    auto siteParser = TreeProvider{std::move(siteTree)};
+    auto cfgReader = figcone::ConfigReader{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.readLayers<Cfg>(
+                        {figcone::ConfigLayer::fromString("", defaultsParser, "defaults"),
+                         figcone::ConfigLayer::fromString("", siteParser, "site")});
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "Config layers 'defaults', 'site': [line:1, column:1] Node 'testNode': Parameter 'testInt' is "
+                        "missing.");
+            });
+}
+
+TEST(TestLayers, UnknownFieldErrorReportsLayer)
+{
+    ///testStr = Hello
+    ///[testNode]
+    ///  testInt = 1
+    auto defaultsTree = figcone::makeTreeRoot();
+    defaultsTree->asItem().addParam("testStr", "Hello", {1, 1});
+    auto& defaultsNode = defaultsTree->asItem().addNode("testNode", {2, 1});
+    defaultsNode.asItem().addParam("testInt", "1", {3, 3});
+
+    ///[testNode]
+    ///  [testNode.unknownNode]
+    auto siteTree = figcone::makeTreeRoot();
+    auto& siteNode = siteTree->asItem().addNode("testNode", {1, 1});
+    siteNode.asItem().addNode("unknownNode", {2, 3});
+
+    auto defaultsParser = TreeProvider{std::move(defaultsTree)};
+    auto siteParser = TreeProvider{std::move(siteTree)};
+    auto cfgReader = figcone::ConfigReader{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.readLayers<Cfg>(
+                        {figcone::ConfigLayer::fromString("", defaultsParser, "defaults"),
+                         figcone::ConfigLayer::fromString("", siteParser, "site")});
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "Config layer 'site': [line:2, column:3] Unknown node 'unknownNode'");
+            });
+}
+
+void readValidatedLayers(figcone::IValidationExecutor* validationExecutor)
+{
+    ///[testNode]
+    ///  testInt = 1
+    auto defaultsTree = figcone::makeTreeRoot();
+    auto& defaultsNode = defaultsTree->asItem().addNode("testNode", {1, 1});
+    defaultsNode.asItem().addParam("testInt", "1", {2, 3});
+
+    ///[testNode]
+    ///  testInt = -1
+    auto siteTree = figcone::makeTreeRoot();
+    auto& siteNode = siteTree->asItem().addNode("testNode", {1, 1});
+    siteNode.asItem().addParam("testInt", "-1", {2, 3});
+
+    auto defaultsParser = TreeProvider{std::move(defaultsTree)};
+    auto siteParser = TreeProvider{std::move(siteTree)};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setValidationExecutor(validationExecutor);
+    cfgReader.readLayers<ValidatedCfg>(
+            {figcone::ConfigLayer::fromString("", defaultsParser, "defaults"),
+             figcone::ConfigLayer::fromString("", siteParser, "site")});
+}
+
+TEST(TestLayers, ValidationErrorReportsLayer)
+{
+    auto threadPool = figcone::ValidationThreadPool{};
+    for (auto validationExecutor : std::vector<figcone::IValidationExecutor*>{nullptr, &threadPool})
+        assert_exception<figcone::ConfigError>(
+                [&]
+                {
+                    readValidatedLayers(validationExecutor);
+                },
+                [](const figcone::ConfigError& error)
+                {
+                    EXPECT_EQ(
+                            std::string{error.what()},
+                            "Config layer 'site': [line:2, column:3] Parameter 'testInt': value can't be negative");
+                });
+}
+
+TEST(TestLayers, MissingFileError)
+{
+    auto parser = TreeProvider{figcone::makeTreeRoot()};
+    auto cfgReader = figcone::ConfigReader{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.readLayers<Cfg>({figcone::ConfigLayer::fromFile("missing_layer.toml", parser)});
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(std::string{error.what()}, "Config file missing_layer.toml doesn't exist");
+            });
+}
+
+} //namespace test_layers
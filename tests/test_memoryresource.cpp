@@ -0,0 +1,159 @@
+#include <figcone/allocationcounting.h>
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <map>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+namespace test_memoryresource {
+
+using StringList = std::pmr::vector<std::pmr::string>;
+using StringMap = std::pmr::map<std::pmr::string, std::pmr::string>;
+
+struct EndpointCfg : public figcone::Config {
+    FIGCONE_PARAM(host, std::pmr::string);
+    FIGCONE_PARAMLIST(aliases, StringList)();
+};
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(name, std::pmr::string);
+    FIGCONE_PARAM(description, figcone::optional<std::pmr::string>);
+    FIGCONE_PARAM(motd, std::pmr::string)("default message of the day");
+    FIGCONE_NODE(primary, EndpointCfg);
+    FIGCONE_NODELIST(endpoints, std::pmr::vector<EndpointCfg>);
+    FIGCONE_DICT(labels, StringMap)();
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+///name = test-memoryresource-config
+///description = config read into a memory resource
+///[primary]
+///  host = primary.memoryresource.test
+///  aliases = [primary-alias.memoryresource.test]
+///[[endpoints]]
+///  host = endpoint-0.memoryresource.test
+///  aliases = [endpoint-0-alias.memoryresource.test]
+///[[endpoints]]
+///  host = endpoint-1.memoryresource.test
+///[labels]
+///  environment = memoryresource-test-environment
+std::unique_ptr<figcone::TreeNode> makeTree()
+{
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("name", "test-memoryresource-config", {1, 1});
+    tree->asItem().addParam("description", "config read into a memory resource", {2, 1});
+    auto& primary = tree->asItem().addNode("primary", {3, 1});
+    primary.asItem().addParam("host", "primary.memoryresource.test", {4, 3});
+    primary.asItem().addParamList("aliases", {"primary-alias.memoryresource.test"}, {5, 3});
+    auto& endpoints = tree->asItem().addNodeList("endpoints", {6, 1});
+    auto& endpoint0 = endpoints.asList().emplaceBack({6, 1});
+    endpoint0.asItem().addParam("host", "endpoint-0.memoryresource.test", {7, 3});
+    endpoint0.asItem().addParamList("aliases", {"endpoint-0-alias.memoryresource.test"}, {8, 3});
+    auto& endpoint1 = endpoints.asList().emplaceBack({9, 1});
+    endpoint1.asItem().addParam("host", "endpoint-1.memoryresource.test", {10, 3});
+    auto& labels = tree->asItem().addNode("labels", {11, 1});
+    labels.asItem().addParam("environment", "memoryresource-test-environment", {12, 3});
+    return tree;
+}
+
+template<typename T>
+std::pmr::memory_resource* resourceOf(const T& value)
+{
+    return value.get_allocator().resource();
+}
+
+TEST(TestMemoryResource, Read)
+{
+    auto resource = figcone::CountingMemoryResource{};
+    auto parser = TreeProvider{makeTree()};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setMemoryResource(&resource);
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.name, "test-memoryresource-config");
+    EXPECT_EQ(resourceOf(cfg.name), &resource);
+    ASSERT_TRUE(cfg.description.has_value());
+    EXPECT_EQ(*cfg.description, "config read into a memory resource");
+    EXPECT_EQ(resourceOf(*cfg.description), &resource);
+    EXPECT_EQ(cfg.motd, "default message of the day");
+    EXPECT_EQ(resourceOf(cfg.motd), &resource);
+
+    EXPECT_EQ(cfg.primary.host, "primary.memoryresource.test");
+    EXPECT_EQ(resourceOf(cfg.primary.host), &resource);
+    ASSERT_EQ(cfg.primary.aliases.size(), 1);
+    EXPECT_EQ(resourceOf(cfg.primary.aliases), &resource);
+    EXPECT_EQ(resourceOf(cfg.primary.aliases.at(0)), &resource);
+
+    EXPECT_EQ(resourceOf(cfg.endpoints), &resource);
+    ASSERT_EQ(cfg.endpoints.size(), 2);
+    EXPECT_EQ(cfg.endpoints.at(0).host, "endpoint-0.memoryresource.test");
+    EXPECT_EQ(resourceOf(cfg.endpoints.at(0).host), &resource);
+    ASSERT_EQ(cfg.endpoints.at(0).aliases.size(), 1);
+    EXPECT_EQ(resourceOf(cfg.endpoints.at(0).aliases.at(0)), &resource);
+    EXPECT_EQ(cfg.endpoints.at(1).host, "endpoint-1.memoryresource.test");
+    EXPECT_EQ(resourceOf(cfg.endpoints.at(1).host), &resource);
+    EXPECT_EQ(resourceOf(cfg.endpoints.at(1).aliases), &resource);
+
+    EXPECT_EQ(resourceOf(cfg.labels), &resource);
+    ASSERT_EQ(cfg.labels.size(), 1);
+    EXPECT_EQ(resourceOf(cfg.labels.begin()->first), &resource);
+    EXPECT_EQ(cfg.labels.begin()->second, "memoryresource-test-environment");
+    EXPECT_EQ(resourceOf(cfg.labels.begin()->second), &resource);
+
+    EXPECT_GT(resource.count().allocations, 0);
+}
+
+TEST(TestMemoryResource, DefaultResource)
+{
+    auto parser = TreeProvider{makeTree()};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.name, "test-memoryresource-config");
+    EXPECT_EQ(resourceOf(cfg.name), std::pmr::get_default_resource());
+    EXPECT_EQ(resourceOf(cfg.motd), std::pmr::get_default_resource());
+    ASSERT_EQ(cfg.endpoints.size(), 2);
+    EXPECT_EQ(resourceOf(cfg.endpoints.at(0).host), std::pmr::get_default_resource());
+    ASSERT_EQ(cfg.labels.size(), 1);
+    EXPECT_EQ(resourceOf(cfg.labels.begin()->second), std::pmr::get_default_resource());
+}
+
+TEST(TestMemoryResource, ResetMemoryResource)
+{
+    auto arena = std::pmr::monotonic_buffer_resource{};
+    auto resource = figcone::CountingMemoryResource{&arena};
+    auto parser = TreeProvider{makeTree()};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setMemoryResource(&resource);
+    {
+        auto cfg = cfgReader.read<Cfg>("", parser);
+        EXPECT_EQ(cfg.endpoints.at(1).host, "endpoint-1.memoryresource.test");
+    }
+    const auto allocationCount = resource.count();
+    EXPECT_GT(allocationCount.allocations, 0);
+
+    cfgReader.setMemoryResource(nullptr);
+    auto defaultParser = TreeProvider{makeTree()};
+    auto cfg = cfgReader.read<Cfg>("", defaultParser);
+    EXPECT_EQ(resourceOf(cfg.name), std::pmr::get_default_resource());
+    EXPECT_EQ(resource.count().allocations, allocationCount.allocations);
+}
+
+} //namespace test_memoryresource
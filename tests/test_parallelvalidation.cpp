@@ -0,0 +1,186 @@
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone/errorreporting.h>
+#include <figcone/errors.h>
+#include <figcone/parallelvalidation.h>
+#include <figcone/readobserver.h>
+#include <figcone/validators.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace test_parallelvalidation {
+
+struct Node : public figcone::Config {
+    FIGCONE_PARAM(testInt, int).ensure<figcone::validator::InRange<0, 10>>();
+};
+
+// non aggregate elements are constructed in place with emplace_back in C++17, so their validators are deferred too
+struct ListNode : public figcone::Config {
+    using Config::Config;
+    FIGCONE_PARAM(testInt, int).ensure<figcone::validator::Min<0>>();
+};
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(testStr, std::string).ensure<figcone::validator::NotEmpty>();
+    FIGCONE_PARAM(testDouble, double).ensure<figcone::validator::Min<0>>();
+    FIGCONE_PARAM(testInt, int);
+    FIGCONE_NODE(testNode, Node);
+    FIGCONE_NODELIST(testNodes, std::vector<ListNode>);
+};
+
+class ValidationPhaseObserver : public figcone::IReadObserver {
+public:
+    void onPhaseBegin(const figcone::ReadPhaseInfo& phaseInfo) override
+    {
+        if (phaseInfo.phase == figcone::ReadPhase::Validation)
+            validatorCounts.push_back(phaseInfo.elementCount);
+    }
+
+    void onPhaseEnd(const figcone::ReadPhaseInfo&) override {}
+
+    std::vector<std::size_t> validatorCounts;
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+std::unique_ptr<figcone::TreeNode> makeTree(
+        const std::string& testStr,
+        const std::string& testNodeInt,
+        const std::string& testInt,
+        const std::string& testDouble,
+        const std::string& testNodesInt)
+{
+    ///testStr = <testStr>
+    ///[testNode]
+    ///  testInt = <testNodeInt>
+    ///testInt = <testInt>
+    ///testDouble = <testDouble>
+    ///[[testNodes]]
+    ///  testInt = 1
+    ///[[testNodes]]
+    ///  testInt = <testNodesInt>
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("testStr", testStr, {1, 1});
+    auto& testNode = tree->asItem().addNode("testNode", {2, 1});
+    testNode.asItem().addParam("testInt", testNodeInt, {3, 3});
+    tree->asItem().addParam("testInt", testInt, {4, 1});
+    tree->asItem().addParam("testDouble", testDouble, {5, 1});
+    auto& testNodes = tree->asItem().addNodeList("testNodes", {6, 1});
+    {
+        auto& node = testNodes.asList().emplaceBack({6, 1});
+        node.asItem().addParam("testInt", "1", {7, 3});
+    }
+    {
+        auto& node = testNodes.asList().emplaceBack({8, 1});
+        node.asItem().addParam("testInt", testNodesInt, {9, 3});
+    }
+    return tree;
+}
+
+std::vector<std::string> readErrors(
+        std::unique_ptr<figcone::TreeNode> tree,
+        figcone::ErrorReporting errorReporting,
+        figcone::IValidationExecutor* validationExecutor)
+{
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::Original, errorReporting};
+    cfgReader.setValidationExecutor(validationExecutor);
+    auto cfg = cfgReader.tryRead<Cfg>("", parser);
+    if (cfg)
+        return {};
+
+    auto result = std::vector<std::string>{};
+    for (const auto& error : cfg.error().errors())
+        result.push_back(error.message);
+    return result;
+}
+
+TEST(TestParallelValidation, Success)
+{
+    auto parser = TreeProvider{makeTree("Hello", "5", "1", "0.5", "2")};
+    auto threadPool = figcone::ValidationThreadPool{};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setValidationExecutor(&threadPool);
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.testStr, "Hello");
+    EXPECT_EQ(cfg.testDouble, 0.5);
+    EXPECT_EQ(cfg.testInt, 1);
+    EXPECT_EQ(cfg.testNode.testInt, 5);
+    ASSERT_EQ(cfg.testNodes.size(), 2);
+    EXPECT_EQ(cfg.testNodes[0].testInt, 1);
+    EXPECT_EQ(cfg.testNodes[1].testInt, 2);
+}
+
+TEST(TestParallelValidation, NodeListElementValidatorsAreDeferred)
+{
+    auto observer = ValidationPhaseObserver{};
+    auto threadPool = figcone::ValidationThreadPool{};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setValidationExecutor(&threadPool);
+    cfgReader.setReadObserver(&observer);
+    for (auto i = 0; i < 2; ++i) {
+        auto parser = TreeProvider{makeTree("Hello", "5", "1", "0.5", "2")};
+        auto cfg = cfgReader.read<Cfg>("", parser);
+        ASSERT_EQ(cfg.testNodes.size(), 2);
+        EXPECT_EQ(cfg.testNodes[1].testInt, 2);
+    }
+    EXPECT_EQ(observer.validatorCounts, (std::vector<std::size_t>{5, 5}));
+}
+
+TEST(TestParallelValidation, AllErrors)
+{
+    auto threadPool = figcone::ValidationThreadPool{};
+    auto errors = readErrors(makeTree("", "20", "hello", "-1", "-2"), figcone::ErrorReporting::AllErrors, &threadPool);
+
+    auto expectedErrors = std::vector<std::string>{
+            "[line:1, column:1] Parameter 'testStr': value can't be empty",
+            "[line:3, column:3] Parameter 'testInt': value must be in range [0, 10]",
+            "[line:4, column:1] Couldn't set parameter 'testInt' value from 'hello'",
+            "[line:5, column:1] Parameter 'testDouble': value can't be less than 0",
+            "[line:9, column:3] Parameter 'testInt': value can't be less than 0"};
+    EXPECT_EQ(errors, expectedErrors);
+}
+
+TEST(TestParallelValidation, SameErrorsAsSequentialMode)
+{
+    const auto testTrees = std::vector<std::vector<std::string>>{
+            {"", "20", "hello", "-1", "-2"},
+            {"Hello", "20", "hello", "-1", "-2"},
+            {"Hello", "5", "hello", "-1", "-2"},
+            {"Hello", "5", "1", "-1", "-2"},
+            {"Hello", "5", "1", "1", "-2"},
+            {"", "5", "1", "1", "2"},
+            {"Hello", "5", "1", "1", "2"}};
+
+    auto threadPool = figcone::ValidationThreadPool{};
+    for (auto errorReporting : {figcone::ErrorReporting::FirstError, figcone::ErrorReporting::AllErrors}) {
+        for (const auto& values : testTrees) {
+            const auto makeTestTree = [&]
+            {
+                return makeTree(values[0], values[1], values[2], values[3], values[4]);
+            };
+            EXPECT_EQ(
+                    readErrors(makeTestTree(), errorReporting, &threadPool),
+                    readErrors(makeTestTree(), errorReporting, nullptr));
+        }
+    }
+}
+
+} //namespace test_parallelvalidation
@@ -4,7 +4,9 @@
 #include <figcone/errors.h>
 #include <figcone_tree/tree.h>
 #include <gtest/gtest.h>
+#include <cstdint>
 #include <deque>
+#include <limits>
 #include <list>
 #include <optional>
 #include <vector>
@@ -92,6 +94,11 @@ struct CfgStr : public figcone::Config {
     FIGCONE_PARAMLIST(testIntList, std::vector<int>)({1, 2, 3});
 };
 
+struct CfgNumbers : public figcone::Config {
+    FIGCONE_PARAMLIST(testInt64List, std::vector<std::int64_t>);
+    FIGCONE_PARAMLIST(testDoubleList, std::vector<double>);
+};
+
 class TreeProvider : public figcone::IParser {
 public:
     TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
@@ -423,4 +430,72 @@ TEST(TestParamList, OverwriteDefaultValue)
     EXPECT_EQ(cfg.testIntList.at(1), 43);
 }
 
+TEST(TestParamList, NumberLists)
+{
+    ///testInt64List = [-9223372036854775808, +5, " 7", 42]
+    ///testDoubleList = [0.1, -2.5e3, +1e-2, 3]
+    ///
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParamList(
+            "testInt64List",
+            std::vector<std::string>{"-9223372036854775808", "+5", " 7", "42"},
+            {1, 1});
+    tree->asItem().addParamList("testDoubleList", std::vector<std::string>{"0.1", "-2.5e3", "+1e-2", "3"}, {2, 1});
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::CamelCase};
+    auto cfg = cfgReader.read<CfgNumbers>("", parser);
+
+    EXPECT_EQ(cfg.testInt64List, (std::vector<std::int64_t>{std::numeric_limits<std::int64_t>::min(), 5, 7, 42}));
+    EXPECT_EQ(cfg.testDoubleList, (std::vector<double>{0.1, -2500.0, 0.01, 3.0}));
+}
+
+TEST(TestParamList, NumberOutOfRangeError)
+{
+    ///testInt64List = [1, 9223372036854775808]
+    ///testDoubleList = []
+    ///
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParamList("testInt64List", std::vector<std::string>{"1", "9223372036854775808"}, {1, 1});
+    tree->asItem().addParamList("testDoubleList", std::vector<std::string>{}, {2, 1});
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::CamelCase};
+
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                auto cfg = cfgReader.read<CfgNumbers>("", parser);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "[line:1, column:1] Couldn't set parameter list element'testInt64List' value from "
+                        "'9223372036854775808'");
+            });
+}
+
+TEST(TestParamList, NumberInfinityError)
+{
+    ///testInt64List = []
+    ///testDoubleList = [1.5, inf]
+    ///
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParamList("testInt64List", std::vector<std::string>{}, {1, 1});
+    tree->asItem().addParamList("testDoubleList", std::vector<std::string>{"1.5", "inf"}, {2, 1});
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::CamelCase};
+
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                auto cfg = cfgReader.read<CfgNumbers>("", parser);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "[line:2, column:1] Couldn't set parameter list element'testDoubleList' value from 'inf'");
+            });
+}
+
 } //namespace test_paramlist
@@ -0,0 +1,119 @@
+#include <figcone/config.h>
+#include <figcone/configlayer.h>
+#include <figcone/configreader.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace test_readerinstantiation {
+
+struct Node : public figcone::Config {
+    FIGCONE_PARAM(testInt, int);
+};
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(testStr, std::string);
+    FIGCONE_NODE(testNode, Node);
+    FIGCONE_NODELIST(testNodes, std::vector<Node>)();
+};
+
+} //namespace test_readerinstantiation
+
+FIGCONE_DECLARE_READER(test_readerinstantiation::Cfg);
+
+namespace test_readerinstantiation {
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+void fillCfgTree(figcone::TreeNode& node, const std::string& testStr)
+{
+    ///testStr = testStr
+    ///[testNode]
+    ///  testInt = 1
+    ///[[testNodes]]
+    ///  testInt = 2
+    node.asItem().addParam("testStr", testStr, {1, 1});
+    node.asItem().addNode("testNode", {2, 1}).asItem().addParam("testInt", "1", {3, 3});
+    auto& testNodes = node.asItem().addNodeList("testNodes", {4, 1});
+    testNodes.asList().emplaceBack({4, 1}).asItem().addParam("testInt", "2", {5, 3});
+}
+
+TEST(TestReaderInstantiation, Read)
+{
+    auto tree = figcone::makeTreeRoot();
+    fillCfgTree(*tree, "Hello");
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.testStr, "Hello");
+    EXPECT_EQ(cfg.testNode.testInt, 1);
+    ASSERT_EQ(cfg.testNodes.size(), 1);
+    EXPECT_EQ(cfg.testNodes[0].testInt, 2);
+}
+
+TEST(TestReaderInstantiation, ReadRootList)
+{
+    auto tree = figcone::makeTreeRootList();
+    fillCfgTree(tree->asList().emplaceBack({1, 1}), "Hello");
+    fillCfgTree(tree->asList().emplaceBack({6, 1}), "World");
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfgList = cfgReader.read<Cfg, figcone::RootType::NodeList>("", parser);
+
+    ASSERT_EQ(cfgList.size(), 2);
+    EXPECT_EQ(cfgList[0].testStr, "Hello");
+    EXPECT_EQ(cfgList[1].testStr, "World");
+}
+
+TEST(TestReaderInstantiation, TryReadError)
+{
+    ///[testNode]
+    ///  testInt = 1
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addNode("testNode", {1, 1}).asItem().addParam("testInt", "1", {2, 3});
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.tryRead<Cfg>("", parser);
+
+    ASSERT_FALSE(cfg);
+    ASSERT_EQ(cfg.error().errors().size(), 1);
+    EXPECT_EQ(cfg.error().errors()[0].message, "[line:1, column:1] Root node: Parameter 'testStr' is missing.");
+}
+
+TEST(TestReaderInstantiation, ReadLayers)
+{
+    auto defaultsTree = figcone::makeTreeRoot();
+    fillCfgTree(*defaultsTree, "Hello");
+    ///testStr = World
+    auto siteTree = figcone::makeTreeRoot();
+    siteTree->asItem().addParam("testStr", "World", {1, 1});
+
+    auto defaultsParser = TreeProvider{std::move(defaultsTree)};
+    auto siteParser = TreeProvider{std::move(siteTree)};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readLayers<Cfg>(
+            {figcone::ConfigLayer::fromString("", defaultsParser, "defaults"),
+             figcone::ConfigLayer::fromString("", siteParser, "site")});
+
+    EXPECT_EQ(cfg.testStr, "World");
+    EXPECT_EQ(cfg.testNode.testInt, 1);
+}
+
+} //namespace test_readerinstantiation
+
+FIGCONE_DEFINE_READER(test_readerinstantiation::Cfg);
@@ -0,0 +1,240 @@
+#include <figcone/chrometraceobserver.h>
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone/parallelvalidation.h>
+#include <figcone/readobserver.h>
+#include <figcone/validators.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace test_readobserver {
+
+struct Node : public figcone::Config {
+    FIGCONE_PARAM(testInt, int).ensure<figcone::validator::Min<0>>();
+};
+
+struct ListNode : public figcone::Config {
+    FIGCONE_PARAM(testStr, std::string);
+};
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(testStr, std::string).ensure<figcone::validator::NotEmpty>();
+    FIGCONE_NODE(testNode, Node);
+    FIGCONE_NODELIST(testNodes, std::vector<ListNode>);
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+class RecordingObserver : public figcone::IReadObserver {
+public:
+    void onPhaseBegin(const figcone::ReadPhaseInfo& phaseInfo) override
+    {
+        events.emplace_back("begin " + describe(phaseInfo));
+    }
+
+    void onPhaseEnd(const figcone::ReadPhaseInfo& phaseInfo) override
+    {
+        events.emplace_back("end " + describe(phaseInfo));
+    }
+
+    std::vector<std::string> events;
+
+private:
+    static std::string describe(const figcone::ReadPhaseInfo& phaseInfo)
+    {
+        auto result = std::string{figcone::readPhaseName(phaseInfo.phase)};
+        if (!phaseInfo.name.empty())
+            result += " '" + std::string{phaseInfo.name} + "'";
+        return result + " " + std::to_string(phaseInfo.byteCount) + " " + std::to_string(phaseInfo.elementCount);
+    }
+};
+
+std::unique_ptr<figcone::TreeNode> makeTree()
+{
+    ///testStr = Hello
+    ///[testNode]
+    ///  testInt = 1
+    ///[[testNodes]]
+    ///  testStr = Foo
+    ///[[testNodes]]
+    ///  testStr = Bar
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("testStr", "Hello", {1, 1});
+    auto& testNode = tree->asItem().addNode("testNode", {2, 1});
+    testNode.asItem().addParam("testInt", "1", {3, 3});
+    auto& testNodes = tree->asItem().addNodeList("testNodes", {4, 1});
+    {
+        auto& node = testNodes.asList().emplaceBack({4, 1});
+        node.asItem().addParam("testStr", "Foo", {5, 3});
+    }
+    {
+        auto& node = testNodes.asList().emplaceBack({6, 1});
+        node.asItem().addParam("testStr", "Bar", {7, 3});
+    }
+    return tree;
+}
+
+TEST(TestReadObserver, ReadPhases)
+{
+    auto parser = TreeProvider{makeTree()};
+    auto observer = RecordingObserver{};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setReadObserver(&observer);
+    auto cfg = cfgReader.read<Cfg>("content", parser);
+    EXPECT_EQ(cfg.testNodes.size(), 2);
+
+    auto expectedEvents = std::vector<std::string>{
+            "begin parse 7 0",
+            "end parse 7 0",
+            "begin load 0 3",
+            "begin node 'testNode' 0 1",
+            "begin validation 0 1",
+            "end validation 0 1",
+            "end node 'testNode' 0 1",
+            "begin node list 'testNodes' 0 2",
+            "begin node list element '0' 0 1",
+            "end node list element '0' 0 1",
+            "begin node list element '1' 0 1",
+            "end node list element '1' 0 1",
+            "end node list 'testNodes' 0 2",
+            "begin validation 0 1",
+            "end validation 0 1",
+            "end load 0 3",
+            "begin post-processing 0 0",
+            "end post-processing 0 0"};
+    EXPECT_EQ(observer.events, expectedEvents);
+}
+
+TEST(TestReadObserver, ParallelValidationPhase)
+{
+    auto parser = TreeProvider{makeTree()};
+    auto observer = RecordingObserver{};
+    auto threadPool = figcone::ValidationThreadPool{};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setValidationExecutor(&threadPool);
+    cfgReader.setReadObserver(&observer);
+    cfgReader.read<Cfg>("", parser);
+
+    auto expectedEvents = std::vector<std::string>{
+            "begin parse 0 0",
+            "end parse 0 0",
+            "begin load 0 3",
+            "begin node 'testNode' 0 1",
+            "end node 'testNode' 0 1",
+            "begin node list 'testNodes' 0 2",
+            "begin node list element '0' 0 1",
+            "end node list element '0' 0 1",
+            "begin node list element '1' 0 1",
+            "end node list element '1' 0 1",
+            "end node list 'testNodes' 0 2",
+            "end load 0 3",
+            "begin validation 0 2",
+            "end validation 0 2",
+            "begin post-processing 0 0",
+            "end post-processing 0 0"};
+    EXPECT_EQ(observer.events, expectedEvents);
+}
+
+TEST(TestReadObserver, FileReadPhase)
+{
+    const auto configFile = std::filesystem::temp_directory_path() / "figcone_test_readobserver.cfg";
+    {
+        auto stream = std::ofstream{configFile};
+        stream << "testStr = Hello";
+    }
+    auto parser = TreeProvider{makeTree()};
+    auto observer = RecordingObserver{};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setReadObserver(&observer);
+    cfgReader.readFile<Cfg>(configFile, parser);
+    std::filesystem::remove(configFile);
+
+    ASSERT_GE(observer.events.size(), 4);
+    EXPECT_EQ(observer.events[0], "begin file read 15 0");
+    EXPECT_EQ(observer.events[1], "end file read 15 0");
+    EXPECT_EQ(observer.events[2], "begin parse 15 0");
+    EXPECT_EQ(observer.events[3], "end parse 15 0");
+}
+
+TEST(TestReadObserver, DetachedObserver)
+{
+    auto parser = TreeProvider{makeTree()};
+    auto observer = RecordingObserver{};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setReadObserver(&observer);
+    cfgReader.setReadObserver(nullptr);
+    cfgReader.read<Cfg>("", parser);
+    EXPECT_TRUE(observer.events.empty());
+}
+
+TEST(TestReadObserver, ChromeTrace)
+{
+    auto parser = TreeProvider{makeTree()};
+    auto observer = figcone::ChromeTraceObserver{};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setReadObserver(&observer);
+    cfgReader.read<Cfg>("", parser);
+
+    const auto trace = observer.trace();
+    EXPECT_EQ(trace.rfind("{\"traceEvents\":[", 0), 0);
+    EXPECT_NE(trace.find(R"({"name":"parse","cat":"parse","ph":"B","ts":)"), std::string::npos);
+    EXPECT_NE(trace.find(R"({"name":"testNodes","cat":"node list","ph":"B","ts":)"), std::string::npos);
+    EXPECT_NE(trace.find(R"(,"pid":1,"tid":1,"args":{"bytes":0,"elements":2}})"), std::string::npos);
+    EXPECT_NE(trace.find(R"({"name":"testNodes","cat":"node list","ph":"E","ts":)"), std::string::npos);
+
+    observer.clear();
+    EXPECT_EQ(observer.trace(), "{\"traceEvents\":[\n]}\n");
+}
+
+struct TestClock {
+    using rep = std::chrono::nanoseconds::rep;
+    using period = std::chrono::nanoseconds::period;
+    using duration = std::chrono::nanoseconds;
+    using time_point = std::chrono::time_point<TestClock>;
+    static constexpr bool is_steady = true;
+
+    static time_point now()
+    {
+        return currentTime;
+    }
+
+    static inline time_point currentTime = {};
+};
+
+TEST(TestReadObserver, ChromeTraceTimestampsInMicroseconds)
+{
+    TestClock::currentTime = TestClock::time_point{};
+    auto observer = figcone::BasicChromeTraceObserver<TestClock>{};
+    TestClock::currentTime += std::chrono::nanoseconds{1234567890};
+    observer.onPhaseBegin({figcone::ReadPhase::Parse, {}, 0, 0});
+    TestClock::currentTime += std::chrono::seconds{2};
+    observer.onPhaseEnd({figcone::ReadPhase::Parse, {}, 0, 0});
+
+    EXPECT_EQ(
+            observer.trace(),
+            "{\"traceEvents\":[\n"
+            R"({"name":"parse","cat":"parse","ph":"B","ts":1234567,"pid":1,"tid":1,"args":{"bytes":0,"elements":0}})"
+            ",\n"
+            R"({"name":"parse","cat":"parse","ph":"E","ts":3234567,"pid":1,"tid":1})"
+            "\n]}\n");
+}
+
+} //namespace test_readobserver
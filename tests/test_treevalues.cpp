@@ -0,0 +1,248 @@
+#include "assert_exception.h"
+#include <figcone/config.h>
+#include <figcone/configlayer.h>
+#include <figcone/configreader.h>
+#include <figcone/errors.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace test_treevalues {
+
+using StringMap = std::map<std::string, std::string>;
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(certificate, std::string);
+    FIGCONE_PARAM(messageTemplate, std::optional<std::string>);
+    FIGCONE_PARAMLIST(templates, std::vector<std::string>);
+    FIGCONE_DICT(snippets, StringMap);
+};
+
+struct ItemCfg : public figcone::Config {
+    FIGCONE_PARAM(name, std::string);
+    FIGCONE_PARAM(description, std::string);
+};
+
+struct CopyListCfg : public figcone::Config {
+    FIGCONE_COPY_NODELIST(items, std::vector<ItemCfg>);
+};
+
+struct ValidatedItemCfg : public figcone::Config {
+    FIGCONE_PARAM(name, std::string);
+    FIGCONE_PARAM(description, std::string).ensure(
+            [](const std::string& value)
+            {
+                if (value.empty())
+                    throw figcone::ValidationError{"value can't be empty"};
+            });
+};
+
+struct ServiceCfg : public figcone::Config {
+    FIGCONE_PARAM(certificate, std::string);
+    FIGCONE_PARAM(port, int)(443);
+    FIGCONE_COPY_NODELIST(items, std::vector<ValidatedItemCfg>);
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+std::string largeText(const std::string& line)
+{
+    auto result = std::string{};
+    for (auto i = 0; i < 100; ++i)
+        result += line + "\n";
+    return result;
+}
+
+std::unique_ptr<figcone::TreeNode> makeTree()
+{
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("certificate", largeText("MIIDdzCCAl+gAwIBAgIEAgAAuTANBgkqhkiG9w0BAQUFADBaMQswCQYD"), {1, 1});
+    tree->asItem().addParam("messageTemplate", largeText("Hello, {name}!"), {2, 1});
+    tree->asItem().addParamList("templates", {largeText("{header}"), largeText("{footer}")}, {3, 1});
+    auto& snippets = tree->asItem().addNode("snippets", {4, 1});
+    snippets.asItem().addParam("greeting", largeText("Welcome, {name}"), {5, 3});
+    return tree;
+}
+
+struct TreeValues {
+    const char* certificate;
+    const char* messageTemplate;
+    const std::string* templates;
+    const char* greeting;
+};
+
+TreeValues treeValues(const figcone::TreeNode& tree)
+{
+    return TreeValues{
+            tree.asItem().param("certificate").value().data(),
+            tree.asItem().param("messageTemplate").value().data(),
+            tree.asItem().param("templates").valueList().data(),
+            tree.asItem().node("snippets").asItem().param("greeting").value().data()};
+}
+
+TEST(TestTreeValues, ReadTree)
+{
+    auto tree = makeTree();
+    const auto values = treeValues(*tree);
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.read<Cfg>(figcone::Tree{std::move(tree)});
+
+    EXPECT_EQ(cfg.certificate, largeText("MIIDdzCCAl+gAwIBAgIEAgAAuTANBgkqhkiG9w0BAQUFADBaMQswCQYD"));
+    EXPECT_EQ(cfg.certificate.data(), values.certificate);
+    ASSERT_TRUE(cfg.messageTemplate.has_value());
+    EXPECT_EQ(*cfg.messageTemplate, largeText("Hello, {name}!"));
+    EXPECT_EQ(cfg.messageTemplate->data(), values.messageTemplate);
+    EXPECT_EQ(cfg.templates, (std::vector<std::string>{largeText("{header}"), largeText("{footer}")}));
+    EXPECT_EQ(cfg.templates.data(), values.templates);
+    ASSERT_EQ(cfg.snippets.size(), 1);
+    EXPECT_EQ(cfg.snippets.at("greeting"), largeText("Welcome, {name}"));
+    EXPECT_EQ(cfg.snippets.at("greeting").data(), values.greeting);
+}
+
+TEST(TestTreeValues, TryReadTree)
+{
+    auto tree = makeTree();
+    const auto values = treeValues(*tree);
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.tryRead<Cfg>(figcone::Tree{std::move(tree)});
+
+    ASSERT_TRUE(cfg);
+    EXPECT_EQ(cfg->certificate.data(), values.certificate);
+    EXPECT_EQ(cfg->templates.data(), values.templates);
+}
+
+TEST(TestTreeValues, ReadWithParser)
+{
+    auto tree = makeTree();
+    const auto values = treeValues(*tree);
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.certificate.data(), values.certificate);
+    EXPECT_EQ(cfg.messageTemplate->data(), values.messageTemplate);
+    EXPECT_EQ(cfg.templates.data(), values.templates);
+    EXPECT_EQ(cfg.snippets.at("greeting").data(), values.greeting);
+}
+
+///items = [{name = "first", description = "<large text>"}, {name = "second"}, {name = "third"}]
+TEST(TestTreeValues, CopyNodeList)
+{
+    auto tree = figcone::makeTreeRoot();
+    auto& items = tree->asItem().addNodeList("items", {1, 1});
+    auto& item0 = items.asList().emplaceBack({1, 1});
+    item0.asItem().addParam("name", "first", {1, 1});
+    item0.asItem().addParam("description", largeText("copied description"), {1, 1});
+    auto& item1 = items.asList().emplaceBack({1, 1});
+    item1.asItem().addParam("name", "second", {1, 1});
+    auto& item2 = items.asList().emplaceBack({1, 1});
+    item2.asItem().addParam("name", "third", {1, 1});
+
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.read<CopyListCfg>(figcone::Tree{std::move(tree)});
+    ASSERT_EQ(cfg.items.size(), 3);
+    EXPECT_EQ(cfg.items.at(0).name, "first");
+    EXPECT_EQ(cfg.items.at(0).description, largeText("copied description"));
+    EXPECT_EQ(cfg.items.at(1).name, "second");
+    EXPECT_EQ(cfg.items.at(1).description, largeText("copied description"));
+    EXPECT_EQ(cfg.items.at(2).name, "third");
+    EXPECT_EQ(cfg.items.at(2).description, largeText("copied description"));
+}
+
+///certificate = "<large text>"
+///port = http
+///items = [{name = "first", description = "<large text>"}, {name = "second", size = 1}, {name = "third"}]
+TEST(TestTreeValues, CopyNodeListAllErrors)
+{
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("certificate", largeText("MIIDdzCCAl+gAwIBAgIEAgAAuTANBgkqhkiG9w0BAQUFADBaMQswCQYD"), {1, 1});
+    tree->asItem().addParam("port", "http", {2, 1});
+    auto& items = tree->asItem().addNodeList("items", {3, 1});
+    auto& item0 = items.asList().emplaceBack({3, 10});
+    item0.asItem().addParam("name", "first", {3, 11});
+    item0.asItem().addParam("description", largeText("copied description"), {3, 26});
+    auto& item1 = items.asList().emplaceBack({3, 60});
+    item1.asItem().addParam("name", "second", {3, 61});
+    item1.asItem().addParam("size", "1", {3, 78});
+    auto& item2 = items.asList().emplaceBack({3, 90});
+    item2.asItem().addParam("name", "third", {3, 91});
+
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::Original, figcone::ErrorReporting::AllErrors};
+    assert_exception<figcone::ConfigErrorList>(
+            [&]
+            {
+                cfgReader.read<ServiceCfg>(figcone::Tree{std::move(tree)});
+            },
+            [](const figcone::ConfigErrorList& error)
+            {
+                // the descriptions of the copied elements are read from the first element after it's loaded, so they
+                // aren't reported as empty
+                const auto& errors = error.errors();
+                ASSERT_EQ(errors.size(), 2);
+                EXPECT_EQ(errors[0].message, "[line:2, column:1] Couldn't set parameter 'port' value from 'http'");
+                EXPECT_EQ(errors[1].message, "[line:3, column:78] Unknown param 'size'");
+            });
+}
+
+TEST(TestTreeValues, CopyNodeListLayers)
+{
+    ///certificate = "<large text>"
+    ///items = [{name = "first", description = "<large text>"}, {name = "second"}]
+    auto defaultsTree = figcone::makeTreeRoot();
+    defaultsTree->asItem().addParam("certificate", largeText("default certificate"), {1, 1});
+    auto& items = defaultsTree->asItem().addNodeList("items", {2, 1});
+    auto& item0 = items.asList().emplaceBack({2, 10});
+    item0.asItem().addParam("name", "first", {2, 11});
+    item0.asItem().addParam("description", largeText("copied description"), {2, 26});
+    auto& item1 = items.asList().emplaceBack({2, 60});
+    item1.asItem().addParam("name", "second", {2, 61});
+
+    ///certificate = "<large text>"
+    auto siteTree = figcone::makeTreeRoot();
+    siteTree->asItem().addParam("certificate", largeText("site certificate"), {1, 1});
+
+    auto defaultsParser = TreeProvider{std::move(defaultsTree)};
+    auto siteParser = TreeProvider{std::move(siteTree)};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readLayers<ServiceCfg>(
+            {figcone::ConfigLayer::fromParser(defaultsParser, "defaults"),
+             figcone::ConfigLayer::fromParser(siteParser, "site")});
+
+    EXPECT_EQ(cfg.certificate, largeText("site certificate"));
+    EXPECT_EQ(cfg.port, 443);
+    ASSERT_EQ(cfg.items.size(), 2);
+    EXPECT_EQ(cfg.items.at(0).name, "first");
+    EXPECT_EQ(cfg.items.at(0).description, largeText("copied description"));
+    EXPECT_EQ(cfg.items.at(1).name, "second");
+    EXPECT_EQ(cfg.items.at(1).description, largeText("copied description"));
+}
+
+TEST(TestTreeValues, ReadTreeTwice)
+{
+    auto cfgReader = figcone::ConfigReader{};
+    auto firstCfg = cfgReader.read<Cfg>(figcone::Tree{makeTree()});
+    auto secondCfg = cfgReader.read<Cfg>(figcone::Tree{makeTree()});
+
+    EXPECT_EQ(firstCfg.certificate, secondCfg.certificate);
+    EXPECT_EQ(firstCfg.templates, secondCfg.templates);
+    EXPECT_EQ(firstCfg.snippets, secondCfg.snippets);
+}
+
+} //namespace test_treevalues
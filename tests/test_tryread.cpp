@@ -0,0 +1,186 @@
+#include <figcone/config.h>
+#include <figcone/configlayer.h>
+#include <figcone/configreader.h>
+#include <figcone/errorreporting.h>
+#include <figcone/errors.h>
+#include <figcone/expected.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace test_tryread {
+
+struct Node : public figcone::Config {
+    FIGCONE_PARAM(testInt, int);
+};
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(testStr, std::string);
+    FIGCONE_PARAM(testDouble, double)(0.0);
+    FIGCONE_NODE(testNode, Node);
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+class FailingParser : public figcone::IParser {
+public:
+    figcone::Tree parse(std::istream&) override
+    {
+        throw figcone::ConfigError{"Parsing error", {1, 5}};
+    }
+};
+
+std::unique_ptr<figcone::TreeNode> makeTree(const std::string& testIntValue)
+{
+    ///testStr = Hello
+    ///[testNode]
+    ///  testInt = <testIntValue>
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("testStr", "Hello", {1, 1});
+    auto& testNode = tree->asItem().addNode("testNode", {2, 1});
+    testNode.asItem().addParam("testInt", testIntValue, {3, 3});
+    return tree;
+}
+
+TEST(TestTryRead, Value)
+{
+    auto parser = TreeProvider{makeTree("10")};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.tryRead<Cfg>("", parser);
+
+    ASSERT_TRUE(cfg);
+    EXPECT_EQ(cfg->testStr, "Hello");
+    EXPECT_EQ(cfg->testDouble, 0.0);
+    EXPECT_EQ(cfg->testNode.testInt, 10);
+}
+
+TEST(TestTryRead, Error)
+{
+    auto parser = TreeProvider{makeTree("hello")};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.tryRead<Cfg>("", parser);
+
+    ASSERT_FALSE(cfg.has_value());
+    ASSERT_EQ(cfg.error().errors().size(), 1);
+    EXPECT_EQ(
+            std::string{cfg.error().what()},
+            "[line:3, column:3] Couldn't set parameter 'testInt' value from 'hello'");
+    EXPECT_EQ(cfg.error().errors()[0].position.line, 3);
+    EXPECT_EQ(cfg.error().errors()[0].position.column, 3);
+}
+
+TEST(TestTryRead, MissingNodeError)
+{
+    ///testStr = Hello
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("testStr", "Hello", {1, 1});
+
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.tryRead<Cfg>("", parser);
+
+    ASSERT_FALSE(cfg.has_value());
+    EXPECT_EQ(std::string{cfg.error().what()}, "[line:1, column:1] Root node: Node 'testNode' is missing.");
+}
+
+TEST(TestTryRead, AllErrors)
+{
+    ///testDouble = hello
+    ///[testNode]
+    ///  testInt = hello
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("testDouble", "hello", {1, 1});
+    auto& testNode = tree->asItem().addNode("testNode", {2, 1});
+    testNode.asItem().addParam("testInt", "hello", {3, 3});
+
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::Original, figcone::ErrorReporting::AllErrors};
+    auto cfg = cfgReader.tryRead<Cfg>("", parser);
+
+    ASSERT_FALSE(cfg.has_value());
+    const auto& errors = cfg.error().errors();
+    ASSERT_EQ(errors.size(), 3);
+    EXPECT_EQ(errors[0].message, "[line:1, column:1] Couldn't set parameter 'testDouble' value from 'hello'");
+    EXPECT_EQ(errors[1].message, "[line:1, column:1] Root node: Parameter 'testStr' is missing.");
+    EXPECT_EQ(errors[2].message, "[line:3, column:3] Couldn't set parameter 'testInt' value from 'hello'");
+}
+
+TEST(TestTryRead, ParserError)
+{
+    auto parser = FailingParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.tryRead<Cfg>("", parser);
+
+    ASSERT_FALSE(cfg.has_value());
+    EXPECT_EQ(std::string{cfg.error().what()}, "[line:1, column:5] Parsing error");
+}
+
+TEST(TestTryRead, MissingFileError)
+{
+    auto parser = TreeProvider{makeTree("10")};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.tryReadFile<Cfg>("missing_config.toml", parser);
+
+    ASSERT_FALSE(cfg.has_value());
+    EXPECT_EQ(std::string{cfg.error().what()}, "Config file missing_config.toml doesn't exist");
+}
+
+TEST(TestTryRead, SingleRootError)
+{
+    auto parser = TreeProvider{figcone::makeTreeRootList()};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.tryRead<Cfg>("", parser);
+
+    ASSERT_FALSE(cfg.has_value());
+    EXPECT_EQ(
+            std::string{cfg.error().what()},
+            "Expected a single element root of the document, use 'readList*' methods instead");
+}
+
+TEST(TestTryRead, Layers)
+{
+    ///[testNode]
+    ///  testInt = hello
+    auto siteTree = figcone::makeTreeRoot();
+    auto& siteNode = siteTree->asItem().addNode("testNode", {1, 1});
+    siteNode.asItem().addParam("testInt", "hello", {2, 3});
+
+    auto defaultsParser = TreeProvider{makeTree("10")};
+    auto siteParser = TreeProvider{std::move(siteTree)};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.tryReadLayers<Cfg>(
+            {figcone::ConfigLayer::fromString("", defaultsParser, "defaults"),
+             figcone::ConfigLayer::fromString("", siteParser, "site")});
+
+    ASSERT_FALSE(cfg.has_value());
+    EXPECT_EQ(
+            std::string{cfg.error().what()},
+            "Config layer 'site': [line:2, column:3] Couldn't set parameter 'testInt' value from 'hello'");
+}
+
+TEST(TestTryRead, ValueOr)
+{
+    auto parser = TreeProvider{makeTree("hello")};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.tryRead<Cfg>("", parser);
+
+    auto defaultCfg = Cfg{};
+    defaultCfg.testStr = "Default";
+    EXPECT_EQ(cfg.value_or(defaultCfg).testStr, "Default");
+}
+
+} //namespace test_tryread
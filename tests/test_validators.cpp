@@ -0,0 +1,242 @@
+#include "assert_exception.h"
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone/errors.h>
+#include <figcone/validators.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <array>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace test_validators {
+
+static constexpr auto logLevels = std::array{"debug", "info", "error"};
+static constexpr char namePattern[] = "[a-z0-9_]+";
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(threads, int).ensure<figcone::validator::InRange<1, 16>>();
+    FIGCONE_PARAM(timeout, double)(1.0).ensure<figcone::validator::Min<0>>();
+    FIGCONE_PARAM(name, std::string)
+            .ensure<figcone::validator::NotEmpty>()
+            .ensure<figcone::validator::MaxLength<8>>()
+            .ensure<figcone::validator::MatchesRegex<namePattern>>();
+    FIGCONE_PARAM(logLevel, std::optional<std::string>).ensure<figcone::validator::OneOf<logLevels>>();
+    FIGCONE_PARAMLIST(ports, std::vector<int>)
+            .ensure<figcone::validator::Sorted>()
+            .ensure<figcone::validator::Unique>();
+};
+
+struct LambdaCfg : public figcone::Config {
+    FIGCONE_PARAM(test, int).ensure(
+            [](int value) -> std::optional<std::string>
+            {
+                if (value % 2)
+                    return "value must be even";
+                return std::nullopt;
+            });
+};
+
+struct BoolResultCfg : public figcone::Config {
+    FIGCONE_PARAM(test, int).ensure(
+            [](int value)
+            {
+                if (value < 0)
+                    throw figcone::ValidationError{"value can't be negative"};
+                return value % 2 == 0;
+            });
+};
+
+struct UnsignedCfg : public figcone::Config {
+    FIGCONE_PARAM(count, unsigned int).ensure<figcone::validator::InRange<-1, 10>>();
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+std::unique_ptr<figcone::TreeNode> makeTree(
+        const std::string& threads,
+        const std::string& name,
+        const std::string& logLevel,
+        const std::vector<std::string>& ports)
+{
+    ///threads = <threads>
+    ///name = <name>
+    ///logLevel = <logLevel>
+    ///ports = <ports>
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("threads", threads, {1, 1});
+    tree->asItem().addParam("name", name, {2, 1});
+    tree->asItem().addParam("logLevel", logLevel, {3, 1});
+    tree->asItem().addParamList("ports", ports, {4, 1});
+    return tree;
+}
+
+void expectError(std::unique_ptr<figcone::TreeNode> tree, const std::string& expectedError)
+{
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.read<Cfg>("", parser);
+            },
+            [&](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(std::string{error.what()}, expectedError);
+            });
+}
+
+TEST(TestValidators, Success)
+{
+    auto parser = TreeProvider{makeTree("4", "worker_1", "info", {"80", "443", "8080"})};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.threads, 4);
+    EXPECT_EQ(cfg.timeout, 1.0);
+    EXPECT_EQ(cfg.name, "worker_1");
+    EXPECT_EQ(cfg.logLevel, "info");
+    EXPECT_EQ(cfg.ports, (std::vector<int>{80, 443, 8080}));
+}
+
+TEST(TestValidators, InRangeError)
+{
+    expectError(
+            makeTree("32", "worker", "info", {"80"}),
+            "[line:1, column:1] Parameter 'threads': value must be in range [1, 16]");
+}
+
+TEST(TestValidators, MinError)
+{
+    auto tree = makeTree("4", "worker", "info", {"80"});
+    tree->asItem().addParam("timeout", "-0.5", {5, 1});
+    expectError(std::move(tree), "[line:5, column:1] Parameter 'timeout': value can't be less than 0");
+}
+
+TEST(TestValidators, NotEmptyError)
+{
+    expectError(makeTree("4", "", "info", {"80"}), "[line:2, column:1] Parameter 'name': value can't be empty");
+}
+
+TEST(TestValidators, MaxLengthError)
+{
+    expectError(
+            makeTree("4", "long_worker_name", "info", {"80"}),
+            "[line:2, column:1] Parameter 'name': value length can't be greater than 8");
+}
+
+TEST(TestValidators, MatchesRegexError)
+{
+    expectError(
+            makeTree("4", "Worker", "info", {"80"}),
+            "[line:2, column:1] Parameter 'name': value must match the regular expression '[a-z0-9_]+'");
+}
+
+TEST(TestValidators, OneOfError)
+{
+    expectError(
+            makeTree("4", "worker", "trace", {"80"}),
+            "[line:3, column:1] Parameter 'logLevel': value must be one of: debug, info, error");
+}
+
+TEST(TestValidators, SortedError)
+{
+    expectError(
+            makeTree("4", "worker", "info", {"443", "80"}),
+            "[line:4, column:1] Parameter list 'ports': list must be sorted");
+}
+
+TEST(TestValidators, UniqueError)
+{
+    expectError(
+            makeTree("4", "worker", "info", {"80", "443", "443"}),
+            "[line:4, column:1] Parameter list 'ports': list elements must be unique, '443' is repeated");
+}
+
+TEST(TestValidators, ErrorMessageReturnedFromLambda)
+{
+    ///test = 3
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("test", "3", {1, 1});
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.read<LambdaCfg>("", parser);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(std::string{error.what()}, "[line:1, column:1] Parameter 'test': value must be even");
+            });
+}
+
+TEST(TestValidators, NegativeBoundOfUnsignedValue)
+{
+    auto makeTreeProvider = [](const std::string& count)
+    {
+        ///count = <count>
+        auto tree = figcone::makeTreeRoot();
+        tree->asItem().addParam("count", count, {1, 1});
+        return TreeProvider{std::move(tree)};
+    };
+    auto cfgReader = figcone::ConfigReader{};
+    auto parser = makeTreeProvider("0");
+    auto cfg = cfgReader.read<UnsignedCfg>("", parser);
+    EXPECT_EQ(cfg.count, 0u);
+
+    auto errorParser = makeTreeProvider("11");
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.read<UnsignedCfg>("", errorParser);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "[line:1, column:1] Parameter 'count': value must be in range [-1, 10]");
+            });
+}
+
+TEST(TestValidators, IgnoredResultOfLambda)
+{
+    auto makeTreeProvider = [](const std::string& test)
+    {
+        ///test = <test>
+        auto tree = figcone::makeTreeRoot();
+        tree->asItem().addParam("test", test, {1, 1});
+        return TreeProvider{std::move(tree)};
+    };
+    auto cfgReader = figcone::ConfigReader{};
+    auto parser = makeTreeProvider("3");
+    auto cfg = cfgReader.read<BoolResultCfg>("", parser);
+    EXPECT_EQ(cfg.test, 3);
+
+    auto errorParser = makeTreeProvider("-1");
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.read<BoolResultCfg>("", errorParser);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(std::string{error.what()}, "[line:1, column:1] Parameter 'test': value can't be negative");
+            });
+}
+
+} //namespace test_validators
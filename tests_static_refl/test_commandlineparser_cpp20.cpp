@@ -0,0 +1,39 @@
+#include <figcone/commandlineparser.h>
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace test_commandlineparser {
+
+struct DbNode {
+    std::string host = "localhost";
+    int poolSize;
+
+    using traits = figcone::FieldTraits< //
+            figcone::OptionalField<&DbNode::host>>;
+};
+
+struct Cfg {
+    std::string testStr;
+    std::vector<int> testList;
+    DbNode db;
+};
+
+TEST(StaticReflTestCommandLineParser, Basic)
+{
+    const char* argv[] = {"app", "--test-str=Hello", "--test-list=1", "--test-list=2", "--db.pool-size", "32"};
+
+    auto parser = figcone::CommandLineParser<Cfg>{6, argv, figcone::NameFormat::KebabCase};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::KebabCase};
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.testStr, "Hello");
+    EXPECT_EQ(cfg.testList, (std::vector<int>{1, 2}));
+    EXPECT_EQ(cfg.db.host, "localhost");
+    EXPECT_EQ(cfg.db.poolSize, 32);
+}
+
+} //namespace test_commandlineparser
@@ -0,0 +1,110 @@
+#include <figcone/config.h>
+#include <figcone/configschema.h>
+#include <gtest/gtest.h>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace test_configschema {
+
+struct ServerCfg {
+    std::string hostName;
+    int port;
+    std::vector<std::string> aliases;
+};
+
+struct TreeNodeCfg {
+    std::string name;
+    std::vector<TreeNodeCfg> children;
+};
+
+struct Cfg {
+    std::string serverName;
+    std::optional<int> maxConnections;
+    ServerCfg mainServer;
+    std::vector<ServerCfg> backupServers;
+    std::map<std::string, std::string> envVars;
+    TreeNodeCfg tree;
+
+    using traits = figcone::FieldTraits<
+            figcone::OptionalField<&Cfg::envVars>,
+            figcone::CopyNodeListField<&Cfg::backupServers>>;
+};
+
+constexpr auto cfgSchema = figcone::schema<Cfg>();
+static_assert(cfgSchema.size() == 6);
+static_assert(cfgSchema[0].name == "serverName");
+static_assert(cfgSchema[0].kind == figcone::FieldKind::Param);
+static_assert(cfgSchema[0].valueType == figcone::FieldValueType::String);
+static_assert(cfgSchema.find("maxConnections")->valueType == figcone::FieldValueType::Integer);
+static_assert(cfgSchema.find("maxConnections")->isOptional);
+static_assert(cfgSchema.find("mainServer")->kind == figcone::FieldKind::Node);
+static_assert(cfgSchema.find("mainServer")->valueType == figcone::FieldValueType::Other);
+static_assert(cfgSchema.find("mainServer")->nestedSchema().find("aliases")->kind == figcone::FieldKind::ParamList);
+static_assert(cfgSchema.find("backupServers")->isCopyNodeList);
+static_assert(cfgSchema.find("envVars")->isOptional);
+static_assert(cfgSchema.find("unknown") == nullptr);
+
+TEST(StaticReflTestConfigSchema, Fields)
+{
+    constexpr auto schema = figcone::schema<Cfg>();
+
+    struct ExpectedField {
+        std::string_view name;
+        figcone::FieldKind kind;
+        bool isOptional;
+        bool isCopyNodeList;
+        std::size_t nestedFieldCount;
+    };
+    auto expectedFields = std::vector<ExpectedField>{
+            {"serverName", figcone::FieldKind::Param, false, false, 0},
+            {"maxConnections", figcone::FieldKind::Param, true, false, 0},
+            {"mainServer", figcone::FieldKind::Node, false, false, 3},
+            {"backupServers", figcone::FieldKind::NodeList, false, true, 3},
+            {"envVars", figcone::FieldKind::Dict, true, false, 0},
+            {"tree", figcone::FieldKind::Node, false, false, 2}};
+    ASSERT_EQ(schema.size(), expectedFields.size());
+    for (auto i = std::size_t{0}; i < schema.size(); ++i) {
+        EXPECT_EQ(schema[i].name, expectedFields[i].name) << i;
+        EXPECT_EQ(schema[i].kind, expectedFields[i].kind) << i;
+        EXPECT_EQ(schema[i].isOptional, expectedFields[i].isOptional) << i;
+        EXPECT_EQ(schema[i].isCopyNodeList, expectedFields[i].isCopyNodeList) << i;
+        EXPECT_EQ(schema[i].nestedSchema().size(), expectedFields[i].nestedFieldCount) << i;
+    }
+}
+
+TEST(StaticReflTestConfigSchema, NameFormat)
+{
+    constexpr auto snakeCaseSchema = figcone::schema<Cfg, figcone::NameFormat::SnakeCase>();
+    static_assert(snakeCaseSchema[0].name == "server_name");
+    static_assert(snakeCaseSchema[2].nestedSchema()[0].name == "host_name");
+
+    constexpr auto kebabCaseSchema = figcone::schema<Cfg, figcone::NameFormat::KebabCase>();
+    static_assert(kebabCaseSchema[1].name == "max-connections");
+    static_assert(kebabCaseSchema[3].nestedSchema()[0].name == "host-name");
+
+    auto names = std::vector<std::string_view>{};
+    for (const auto& field : snakeCaseSchema)
+        names.push_back(field.name);
+    EXPECT_EQ(
+            names,
+            (std::vector<std::string_view>{
+                    "server_name",
+                    "max_connections",
+                    "main_server",
+                    "backup_servers",
+                    "env_vars",
+                    "tree"}));
+}
+
+TEST(StaticReflTestConfigSchema, RecursiveNodeList)
+{
+    constexpr auto schema = figcone::schema<TreeNodeCfg>();
+    static_assert(schema[1].kind == figcone::FieldKind::NodeList);
+    static_assert(schema[1].nestedSchema()[1].nestedSchema()[0].name == "name");
+    EXPECT_EQ(schema[1].nestedSchema().begin(), schema.begin());
+}
+
+} //namespace test_configschema
@@ -0,0 +1,58 @@
+#include <figcone/configreader.h>
+#include <figcone/constraints.h>
+#include <figcone/errors.h>
+#include <gtest/gtest.h>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace test_constraints {
+
+struct Server {
+    std::string host;
+    int port;
+};
+
+struct Cfg {
+    Server server;
+    std::vector<int> allowedPorts;
+    std::optional<std::string> name;
+};
+
+TEST(StaticReflTestConstraints, IncrementalCheck)
+{
+    auto evaluationCount = 0;
+    auto constraints = figcone::Constraints<Cfg>{};
+    constraints.add(
+            "allowedPort",
+            {"server.port", "allowedPorts"},
+            [&](const Cfg& cfg) -> std::optional<std::string>
+            {
+                ++evaluationCount;
+                for (auto port : cfg.allowedPorts)
+                    if (port == cfg.server.port)
+                        return std::nullopt;
+                return "port " + std::to_string(cfg.server.port) + " isn't allowed";
+            });
+
+    auto cfg = Cfg{{"localhost", 80}, {80, 443}, std::nullopt};
+    EXPECT_FALSE(constraints.tryCheck(cfg).has_value());
+    EXPECT_EQ(evaluationCount, 1);
+
+    cfg.server.host = "example.com";
+    cfg.name = "test";
+    EXPECT_FALSE(constraints.tryCheck(cfg).has_value());
+    EXPECT_EQ(evaluationCount, 1);
+
+    cfg.server.port = 8080;
+    auto errors = constraints.tryCheck(cfg);
+    ASSERT_TRUE(errors.has_value());
+    EXPECT_EQ(std::string{errors->what()}, "Constraint 'allowedPort': port 8080 isn't allowed");
+    EXPECT_EQ(evaluationCount, 2);
+
+    cfg.allowedPorts.push_back(8080);
+    EXPECT_FALSE(constraints.tryCheck(cfg).has_value());
+    EXPECT_EQ(evaluationCount, 3);
+}
+
+} //namespace test_constraints
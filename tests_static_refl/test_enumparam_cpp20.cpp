@@ -0,0 +1,83 @@
+#include "assert_exception.h"
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone/errors.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <optional>
+#include <vector>
+
+#ifdef FIGCONE_NAMEOF_AVAILABLE
+
+namespace test_enumparam {
+
+enum class Color {
+    Red,
+    DarkRed,
+    LightBlue = 10,
+};
+
+struct Cfg {
+    Color color;
+    std::optional<Color> optionalColor;
+    std::vector<Color> colors;
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+TEST(StaticReflTestEnumParam, Read)
+{
+    ///color = light_blue
+    ///optionalColor = darkRed
+    ///colors = [Red, dark-red]
+    ///
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("color", "light_blue", {1, 1});
+    tree->asItem().addParam("optionalColor", "darkRed", {2, 1});
+    tree->asItem().addParamList("colors", {"Red", "dark-red"}, {3, 1});
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.color, Color::LightBlue);
+    EXPECT_EQ(cfg.optionalColor, Color::DarkRed);
+    EXPECT_EQ(cfg.colors, (std::vector<Color>{Color::Red, Color::DarkRed}));
+}
+
+TEST(StaticReflTestEnumParam, UnknownNameError)
+{
+    ///color = Purple
+    ///
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("color", "Purple", {1, 1});
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.read<Cfg>("", parser);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "[line:1, column:1] Couldn't set parameter 'color' value from 'Purple'");
+            });
+}
+
+} //namespace test_enumparam
+
+#endif
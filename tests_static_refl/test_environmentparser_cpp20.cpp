@@ -0,0 +1,44 @@
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone/environmentparser.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace test_environmentparser {
+
+struct DbNode {
+    std::string host = "localhost";
+    int poolSize;
+
+    using traits = figcone::FieldTraits< //
+            figcone::OptionalField<&DbNode::host>>;
+};
+
+struct Cfg {
+    std::string testStr;
+    std::vector<int> testList;
+    DbNode db;
+};
+
+TEST(StaticReflTestEnvironmentParser, Basic)
+{
+    const char* environment[] = {
+            "APP_TEST_STR=Hello",
+            "APP_TEST_LIST=1,2,3",
+            "APP_DB__POOL_SIZE=32",
+            "APP_DB__UNKNOWN=1",
+            nullptr};
+
+    auto parser = figcone::EnvironmentParser<Cfg>{"APP", figcone::NameFormat::SnakeCase, environment};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::SnakeCase};
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.testStr, "Hello");
+    EXPECT_EQ(cfg.testList, (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(cfg.db.host, "localhost");
+    EXPECT_EQ(cfg.db.poolSize, 32);
+}
+
+} //namespace test_environmentparser
@@ -0,0 +1,73 @@
+#include "assert_exception.h"
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone/errorreporting.h>
+#include <figcone/errors.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace test_errorreporting {
+
+struct Node {
+    int testInt;
+};
+
+struct Cfg {
+    std::string testStr;
+    Node testNode;
+    std::vector<Node> testNodes;
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+TEST(StaticReflTestErrorReporting, AllErrors)
+{
+    ///testUnknown = 1
+    ///[testNode]
+    ///  testInt = hello
+    ///[[testNodes]]
+    ///  testInt = world
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("testUnknown", "1", {1, 1});
+    auto& testNode = tree->asItem().addNode("testNode", {2, 1});
+    testNode.asItem().addParam("testInt", "hello", {3, 3});
+    auto& testNodes = tree->asItem().addNodeList("testNodes", {4, 1});
+    {
+        auto& node = testNodes.asList().emplaceBack({4, 1});
+        node.asItem().addParam("testInt", "world", {5, 3});
+    }
+
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::Original, figcone::ErrorReporting::AllErrors};
+    assert_exception<figcone::ConfigErrorList>(
+            [&]
+            {
+                cfgReader.read<Cfg>("", parser);
+            },
+            [](const figcone::ConfigErrorList& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "[line:1, column:1] Unknown param 'testUnknown'\n"
+                        "[line:1, column:1] Root node: Parameter 'testStr' is missing.\n"
+                        "[line:3, column:3] Couldn't set parameter 'testInt' value from 'hello'\n"
+                        "[line:5, column:3] Couldn't set parameter 'testInt' value from 'world'");
+            });
+}
+
+} //namespace test_errorreporting
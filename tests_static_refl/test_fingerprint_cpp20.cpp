@@ -0,0 +1,103 @@
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone/fingerprint.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <map>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace test_fingerprint {
+
+struct Node {
+    int testInt;
+    std::string testString;
+};
+
+struct Cfg {
+    int foo;
+    std::optional<std::string> bar;
+    std::vector<int> testList;
+    Node testNode;
+    std::optional<Node> optTestNode;
+    std::vector<Node> testNodes;
+    std::map<std::string, int> testDict;
+    std::unordered_map<std::string, std::string> testUnorderedDict;
+};
+
+Cfg makeCfg()
+{
+    auto cfg = Cfg{};
+    cfg.foo = 1;
+    cfg.bar = "test";
+    cfg.testList = {1, 2, 3};
+    cfg.testNode = {10, "Hello world"};
+    cfg.testNodes = {{100, ""}, {200, ""}};
+    cfg.testDict = {{"a", 1}, {"b", 2}};
+    for (auto i = 0; i < 32; ++i)
+        cfg.testUnorderedDict.emplace("key" + std::to_string(i), std::to_string(i));
+    return cfg;
+}
+
+TEST(StaticReflTestFingerprint, EqualConfigs)
+{
+    auto cfg = makeCfg();
+    auto cfg2 = makeCfg();
+    EXPECT_TRUE(figcone::equal(cfg, cfg2));
+    EXPECT_EQ(figcone::fingerprint(cfg), figcone::fingerprint(cfg2));
+}
+
+TEST(StaticReflTestFingerprint, ModifiedParam)
+{
+    auto cfg = makeCfg();
+    auto cfg2 = makeCfg();
+    cfg2.foo = 2;
+    EXPECT_FALSE(figcone::equal(cfg, cfg2));
+    EXPECT_NE(figcone::fingerprint(cfg), figcone::fingerprint(cfg2));
+}
+
+TEST(StaticReflTestFingerprint, ModifiedOptionalNode)
+{
+    auto cfg = makeCfg();
+    auto cfg2 = makeCfg();
+    cfg2.optTestNode = Node{1, "test"};
+    EXPECT_FALSE(figcone::equal(cfg, cfg2));
+    EXPECT_NE(figcone::fingerprint(cfg), figcone::fingerprint(cfg2));
+}
+
+TEST(StaticReflTestFingerprint, ModifiedNodeList)
+{
+    auto cfg = makeCfg();
+    auto cfg2 = makeCfg();
+    cfg2.testNodes[1].testString = "test";
+    EXPECT_FALSE(figcone::equal(cfg, cfg2));
+    EXPECT_NE(figcone::fingerprint(cfg), figcone::fingerprint(cfg2));
+}
+
+TEST(StaticReflTestFingerprint, ModifiedDict)
+{
+    auto cfg = makeCfg();
+    auto cfg2 = makeCfg();
+    cfg2.testUnorderedDict.erase("key0");
+    EXPECT_FALSE(figcone::equal(cfg, cfg2));
+    EXPECT_NE(figcone::fingerprint(cfg), figcone::fingerprint(cfg2));
+}
+
+TEST(StaticReflTestFingerprint, NodeSection)
+{
+    auto cfg = makeCfg();
+    auto cfg2 = makeCfg();
+    cfg2.foo = 2;
+    EXPECT_TRUE(figcone::equal(cfg.testNode, cfg2.testNode));
+    EXPECT_EQ(figcone::fingerprint(cfg.testNode), figcone::fingerprint(cfg2.testNode));
+}
+
+TEST(StaticReflTestFingerprint, SameFingerprintAsRuntimeReflection)
+{
+    auto cfg = Node{1, "test"};
+    EXPECT_EQ(figcone::fingerprint(cfg), 0x5f1f7c75dd96a0a4ULL);
+}
+
+} //namespace test_fingerprint
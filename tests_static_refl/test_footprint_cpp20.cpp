@@ -0,0 +1,85 @@
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone/footprint.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <map>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace test_footprint {
+
+struct Node {
+    std::string testStr;
+    std::vector<int> testList;
+};
+
+struct Cfg {
+    std::string name;
+    std::optional<std::string> optName;
+    std::vector<int> values;
+    Node testNode;
+    std::vector<Node> testNodes;
+    std::map<std::string, std::string> testDict;
+};
+
+const figcone::FieldFootprint& findField(const figcone::ConfigFootprint& footprint, const std::string& path)
+{
+    auto it = std::find_if(
+            footprint.fields.begin(),
+            footprint.fields.end(),
+            [&](const figcone::FieldFootprint& field)
+            {
+                return field.path == path;
+            });
+    if (it == footprint.fields.end())
+        throw std::runtime_error{"Field " + path + " isn't found"};
+    return *it;
+}
+
+TEST(StaticReflTestFootprint, Footprint)
+{
+    auto cfg = Cfg{};
+    cfg.optName = std::string(100, 'x');
+    cfg.values.reserve(1000);
+    cfg.values = {1, 2, 3};
+    cfg.testNode.testList = {1, 2};
+    cfg.testNodes.resize(2);
+    cfg.testNodes[1].testList = {1, 2, 3, 4};
+
+    auto footprint = figcone::footprint(cfg);
+    EXPECT_EQ(footprint.size, sizeof(Cfg));
+    auto paths = std::vector<std::string>{};
+    for (const auto& field : footprint.fields)
+        paths.push_back(field.path);
+    std::sort(paths.begin(), paths.end());
+    auto expectedPaths = std::vector<std::string>{
+            "name",
+            "optName",
+            "testDict",
+            "testNode",
+            "testNode.testList",
+            "testNode.testStr",
+            "testNodes",
+            "testNodes.testList",
+            "testNodes.testStr",
+            "values"};
+    EXPECT_EQ(paths, expectedPaths);
+    EXPECT_EQ(footprint.fields.front().path, "values");
+
+    const auto& optName = findField(footprint, "optName");
+    EXPECT_EQ(optName.heapBytes, cfg.optName->capacity() + 1);
+
+    const auto& values = findField(footprint, "values");
+    EXPECT_EQ(values.heapBytes, cfg.values.capacity() * sizeof(int));
+    EXPECT_TRUE(values.hasWastedCapacity);
+
+    const auto& testNodesList = findField(footprint, "testNodes.testList");
+    EXPECT_EQ(testNodesList.size, 2 * sizeof(std::vector<int>));
+    EXPECT_EQ(testNodesList.heapBytes, cfg.testNodes[1].testList.capacity() * sizeof(int));
+    EXPECT_FALSE(testNodesList.hasWastedCapacity);
+}
+
+} //namespace test_footprint
@@ -0,0 +1,217 @@
+#include "assert_exception.h"
+#include <figcone/config.h>
+#include <figcone/configlayer.h>
+#include <figcone/configreader.h>
+#include <figcone/errors.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace test_layers {
+
+struct Node {
+    int testInt;
+    std::string testString = "default";
+
+    using traits = figcone::FieldTraits< //
+            figcone::OptionalField<&Node::testString>>;
+};
+
+struct Cfg {
+    std::string testStr;
+    std::vector<int> testList;
+    Node testNode;
+    std::vector<Node> testNodes;
+    std::map<std::string, int> testDict;
+
+    using traits = figcone::FieldTraits< //
+            figcone::OptionalField<&Cfg::testList>,
+            figcone::OptionalField<&Cfg::testNodes>,
+            figcone::OptionalField<&Cfg::testDict> //
+            >;
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+TEST(StaticReflTestLayers, Basic)
+{
+    ///testStr = Hello
+    ///testList = [1, 2]
+    ///[testNode]
+    ///  testInt = 1
+    ///[testDict]
+    ///  foo = 1
+    ///  bar = 2
+    ///[[testNodes]]
+    ///  testInt = 1
+    auto defaultsTree = figcone::makeTreeRoot();
+    defaultsTree->asItem().addParam("testStr", "Hello", {1, 1});
+    defaultsTree->asItem().addParamList("testList", {"1", "2"}, {2, 1});
+    auto& defaultsNode = defaultsTree->asItem().addNode("testNode", {3, 1});
+    defaultsNode.asItem().addParam("testInt", "1", {4, 3});
+    auto& defaultsDict = defaultsTree->asItem().addNode("testDict", {5, 1});
+    defaultsDict.asItem().addParam("foo", "1", {6, 3});
+    defaultsDict.asItem().addParam("bar", "2", {7, 3});
+    auto& defaultsNodes = defaultsTree->asItem().addNodeList("testNodes", {8, 1});
+    {
+        auto& node = defaultsNodes.asList().emplaceBack({8, 1});
+        node.asItem().addParam("testInt", "1", {9, 3});
+    }
+
+    ///testList = [3]
+    ///[testNode]
+    ///  testString = site
+    ///[testDict]
+    ///  bar = 20
+    ///[[testNodes]]
+    ///  testInt = 2
+    ///[[testNodes]]
+    ///  testInt = 3
+    auto siteTree = figcone::makeTreeRoot();
+    siteTree->asItem().addParamList("testList", {"3"}, {1, 1});
+    auto& siteNode = siteTree->asItem().addNode("testNode", {2, 1});
+    siteNode.asItem().addParam("testString", "site", {3, 3});
+    auto& siteDict = siteTree->asItem().addNode("testDict", {4, 1});
+    siteDict.asItem().addParam("bar", "20", {5, 3});
+    auto& siteNodes = siteTree->asItem().addNodeList("testNodes", {6, 1});
+    {
+        auto& node = siteNodes.asList().emplaceBack({6, 1});
+        node.asItem().addParam("testInt", "2", {7, 3});
+    }
+    {
+        auto& node = siteNodes.asList().emplaceBack({8, 1});
+        node.asItem().addParam("testInt", "3", {9, 3});
+    }
+
+    auto defaultsParser = TreeProvider{std::move(defaultsTree)};
+    auto siteParser = TreeProvider{std::move(siteTree)};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readLayers<Cfg>(
+            {figcone::ConfigLayer::fromString("", defaultsParser, "defaults"),
+             figcone::ConfigLayer::fromString("", siteParser, "site")});
+
+    EXPECT_EQ(cfg.testStr, "Hello");
+    EXPECT_EQ(cfg.testList, std::vector<int>{3});
+    EXPECT_EQ(cfg.testNode.testInt, 1);
+    EXPECT_EQ(cfg.testNode.testString, "site");
+    EXPECT_EQ(cfg.testDict, (std::map<std::string, int>{{"foo", 1}, {"bar", 20}}));
+    ASSERT_EQ(cfg.testNodes.size(), 2);
+    EXPECT_EQ(cfg.testNodes[0].testInt, 2);
+    EXPECT_EQ(cfg.testNodes[1].testInt, 3);
+}
+
+TEST(StaticReflTestLayers, ParamErrorReportsLayer)
+{
+    ///testStr = Hello
+    ///[testNode]
+    ///  testInt = 1
+    auto defaultsTree = figcone::makeTreeRoot();
+    defaultsTree->asItem().addParam("testStr", "Hello", {1, 1});
+    auto& defaultsNode = defaultsTree->asItem().addNode("testNode", {2, 1});
+    defaultsNode.asItem().addParam("testInt", "1", {3, 3});
+
+    ///[testNode]
+    ///  testInt = hello
+    auto siteTree = figcone::makeTreeRoot();
+    auto& siteNode = siteTree->asItem().addNode("testNode", {1, 1});
+    siteNode.asItem().addParam("testInt", "hello", {2, 3});
+
+    auto defaultsParser = TreeProvider{std::move(defaultsTree)};
+    auto siteParser = TreeProvider{std::move(siteTree)};
+    auto cfgReader = figcone::ConfigReader{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.readLayers<Cfg>(
+                        {figcone::ConfigLayer::fromString("", defaultsParser, "defaults"),
+                         figcone::ConfigLayer::fromString("", siteParser, "site")});
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "Config layer 'site': [line:2, column:3] Couldn't set parameter 'testInt' value from 'hello'");
+            });
+}
+
+TEST(StaticReflTestLayers, UnknownFieldErrorReportsLayer)
+{
+    ///testStr = Hello
+    ///[testNode]
+    ///  testInt = 1
+    auto defaultsTree = figcone::makeTreeRoot();
+    defaultsTree->asItem().addParam("testStr", "Hello", {1, 1});
+    auto& defaultsNode = defaultsTree->asItem().addNode("testNode", {2, 1});
+    defaultsNode.asItem().addParam("testInt", "1", {3, 3});
+
+    ///[testNode]
+    ///  unknownParam = 1
+    auto siteTree = figcone::makeTreeRoot();
+    auto& siteNode = siteTree->asItem().addNode("testNode", {1, 1});
+    siteNode.asItem().addParam("unknownParam", "1", {2, 3});
+
+    auto defaultsParser = TreeProvider{std::move(defaultsTree)};
+    auto siteParser = TreeProvider{std::move(siteTree)};
+    auto cfgReader = figcone::ConfigReader{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.readLayers<Cfg>(
+                        {figcone::ConfigLayer::fromString("", defaultsParser, "defaults"),
+                         figcone::ConfigLayer::fromString("", siteParser, "site")});
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "Config layer 'site': [line:2, column:3] Unknown param 'unknownParam'");
+            });
+}
+
+TEST(StaticReflTestLayers, MissingParamErrorReportsLayers)
+{
+    ///[testNode]
+    ///  testInt = 1
+    auto defaultsTree = figcone::makeTreeRoot();
+    auto& defaultsNode = defaultsTree->asItem().addNode("testNode", {1, 1});
+    defaultsNode.asItem().addParam("testInt", "1", {2, 3});
+
+    ///testList = [1]
+    auto siteTree = figcone::makeTreeRoot();
+    siteTree->asItem().addParamList("testList", {"1"}, {1, 1});
+
+    auto defaultsParser = TreeProvider{std::move(defaultsTree)};
+    auto siteParser = TreeProvider{std::move(siteTree)};
+    auto cfgReader = figcone::ConfigReader{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.readLayers<Cfg>(
+                        {figcone::ConfigLayer::fromString("", defaultsParser, "defaults"),
+                         figcone::ConfigLayer::fromString("", siteParser, "site")});
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "Config layers 'defaults', 'site': [line:1, column:1] Root node: Parameter 'testStr' is "
+                        "missing.");
+            });
+}
+
+} //namespace test_layers
@@ -0,0 +1,135 @@
+#include <figcone/configreader.h>
+#include <figcone/errorreporting.h>
+#include <figcone/errors.h>
+#include <figcone/parallelvalidation.h>
+#include <figcone/validators.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace test_parallelvalidation {
+
+struct Node {
+    int testInt;
+
+    using traits = figcone::FieldTraits<figcone::ValidatedField<&Node::testInt, figcone::validator::InRange<0, 10>>>;
+};
+
+struct Cfg {
+    std::string testStr;
+    double testDouble;
+    Node testNode;
+
+    using traits = figcone::FieldTraits<
+            figcone::ValidatedField<&Cfg::testStr, figcone::validator::NotEmpty>,
+            figcone::ValidatedField<&Cfg::testDouble, figcone::validator::Min<0>>>;
+};
+
+struct ListCfg {
+    std::vector<Node> testNodes;
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+std::unique_ptr<figcone::TreeNode> makeTree(
+        const std::string& testStr,
+        const std::string& testDouble,
+        const std::string& testNodeInt)
+{
+    ///testStr = <testStr>
+    ///testDouble = <testDouble>
+    ///[testNode]
+    ///  testInt = <testNodeInt>
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("testStr", testStr, {1, 1});
+    tree->asItem().addParam("testDouble", testDouble, {2, 1});
+    auto& testNode = tree->asItem().addNode("testNode", {3, 1});
+    testNode.asItem().addParam("testInt", testNodeInt, {4, 3});
+    return tree;
+}
+
+figcone::ConfigReader makeReader(figcone::ErrorReporting errorReporting)
+{
+    static auto threadPool = figcone::ValidationThreadPool{};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::Original, errorReporting};
+    cfgReader.setValidationExecutor(&threadPool);
+    return cfgReader;
+}
+
+TEST(StaticReflTestParallelValidation, Success)
+{
+    auto parser = TreeProvider{makeTree("Hello", "0.5", "5")};
+    auto cfgReader = makeReader(figcone::ErrorReporting::FirstError);
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.testStr, "Hello");
+    EXPECT_EQ(cfg.testDouble, 0.5);
+    EXPECT_EQ(cfg.testNode.testInt, 5);
+}
+
+TEST(StaticReflTestParallelValidation, FirstError)
+{
+    auto parser = TreeProvider{makeTree("", "-1", "20")};
+    auto cfgReader = makeReader(figcone::ErrorReporting::FirstError);
+    auto cfg = cfgReader.tryRead<Cfg>("", parser);
+
+    ASSERT_FALSE(cfg.has_value());
+    ASSERT_EQ(cfg.error().errors().size(), 1);
+    EXPECT_EQ(
+            cfg.error().errors()[0].message,
+            "[line:4, column:3] Parameter 'testInt': value must be in range [0, 10]");
+}
+
+TEST(StaticReflTestParallelValidation, AllErrors)
+{
+    auto parser = TreeProvider{makeTree("", "-1", "20")};
+    auto cfgReader = makeReader(figcone::ErrorReporting::AllErrors);
+    auto cfg = cfgReader.tryRead<Cfg>("", parser);
+
+    ASSERT_FALSE(cfg.has_value());
+    const auto& errors = cfg.error().errors();
+    ASSERT_EQ(errors.size(), 3);
+    EXPECT_EQ(errors[0].message, "[line:1, column:1] Parameter 'testStr': value can't be empty");
+    EXPECT_EQ(errors[1].message, "[line:2, column:1] Parameter 'testDouble': value can't be less than 0");
+    EXPECT_EQ(errors[2].message, "[line:4, column:3] Parameter 'testInt': value must be in range [0, 10]");
+}
+
+TEST(StaticReflTestParallelValidation, NodeListElementErrors)
+{
+    ///[[testNodes]]
+    ///  testInt = 20
+    ///[[testNodes]]
+    ///  testInt = 5
+    ///[[testNodes]]
+    ///  testInt = -1
+    auto tree = figcone::makeTreeRoot();
+    auto& testNodes = tree->asItem().addNodeList("testNodes", {1, 1});
+    testNodes.asList().emplaceBack({1, 1}).asItem().addParam("testInt", "20", {2, 3});
+    testNodes.asList().emplaceBack({3, 1}).asItem().addParam("testInt", "5", {4, 3});
+    testNodes.asList().emplaceBack({5, 1}).asItem().addParam("testInt", "-1", {6, 3});
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = makeReader(figcone::ErrorReporting::AllErrors);
+    auto cfg = cfgReader.tryRead<ListCfg>("", parser);
+
+    ASSERT_FALSE(cfg.has_value());
+    const auto& errors = cfg.error().errors();
+    ASSERT_EQ(errors.size(), 2);
+    EXPECT_EQ(errors[0].message, "[line:2, column:3] Parameter 'testInt': value must be in range [0, 10]");
+    EXPECT_EQ(errors[1].message, "[line:6, column:3] Parameter 'testInt': value must be in range [0, 10]");
+}
+
+} //namespace test_parallelvalidation
@@ -34,6 +34,15 @@ struct ValidatedOptionalParamCfg {
 
     using traits = figcone::FieldTraits<figcone::ValidatedField<&ValidatedOptionalParamCfg::test, IsPositive>>;
 };
+
+struct SameTypeParamsCfg {
+    int testInt;
+    int testInt2 = 9;
+
+    using traits = figcone::FieldTraits< //
+            figcone::OptionalField<&SameTypeParamsCfg::testInt2>,
+            figcone::ValidatedField<&SameTypeParamsCfg::testInt2, IsPositive>>;
+};
 //
 //struct ValidatedWithFunctorOptionalParamCfg {
 //    FIGCONE_PARAM(test, figcone::optional<int>).ensure<IsPositive>();
@@ -250,6 +259,43 @@ TEST(StaticReflTestParam, ValidationErrorOptionalParam)
             });
 }
 
+TEST(StaticReflTestParam, TraitsOfSameTypeParams)
+{
+    ///testInt=-1
+    ///
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("testInt", "-1", {1, 1});
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::CamelCase};
+    auto cfg = cfgReader.read<SameTypeParamsCfg>("", parser);
+
+    EXPECT_EQ(cfg.testInt, -1);
+    EXPECT_EQ(cfg.testInt2, 9);
+}
+
+TEST(StaticReflTestParam, TraitsOfSameTypeParamsValidationError)
+{
+    ///testInt=1
+    ///testInt2=-1
+    ///
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("testInt", "1", {1, 1});
+    tree->asItem().addParam("testInt2", "-1", {2, 1});
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::CamelCase};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.read<SameTypeParamsCfg>("", parser);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "[line:2, column:1] Parameter 'testInt2': value can't be negative");
+            });
+}
+
 TEST(StaticReflTestParam, ParamWrongTypeError)
 {
     ///test = hello
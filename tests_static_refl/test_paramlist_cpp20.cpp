@@ -4,7 +4,9 @@
 #include <figcone/errors.h>
 #include <figcone_tree/tree.h>
 #include <gtest/gtest.h>
+#include <cstdint>
 #include <deque>
+#include <limits>
 #include <list>
 #include <optional>
 #include <vector>
@@ -23,6 +25,11 @@ struct CfgOptInt {
     std::optional<std::deque<int>> testIntList;
 };
 
+struct CfgNumbers {
+    std::vector<std::int64_t> testInt64List;
+    std::vector<double> testDoubleList;
+};
+
 struct NotEmpty {
     template<typename T>
     void operator()(const T& value)
@@ -283,4 +290,23 @@ TEST(TestParamList, OverwriteDefaultValue)
     EXPECT_EQ(cfg.testIntList.at(1), 43);
 }
 
+TEST(StaticReflTestParamList, NumberLists)
+{
+    ///testInt64List = [-9223372036854775808, +5, " 7", 42]
+    ///testDoubleList = [0.1, -2.5e3, +1e-2, 3]
+    ///
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParamList(
+            "testInt64List",
+            std::vector<std::string>{"-9223372036854775808", "+5", " 7", "42"},
+            {1, 1});
+    tree->asItem().addParamList("testDoubleList", std::vector<std::string>{"0.1", "-2.5e3", "+1e-2", "3"}, {2, 1});
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::CamelCase};
+    auto cfg = cfgReader.read<CfgNumbers>("", parser);
+
+    EXPECT_EQ(cfg.testInt64List, (std::vector<std::int64_t>{std::numeric_limits<std::int64_t>::min(), 5, 7, 42}));
+    EXPECT_EQ(cfg.testDoubleList, (std::vector<double>{0.1, -2500.0, 0.01, 3.0}));
+}
+
 } //namespace test_paramlist
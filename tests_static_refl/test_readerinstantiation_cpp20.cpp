@@ -0,0 +1,65 @@
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace test_readerinstantiation {
+
+struct Node {
+    int testInt;
+};
+
+struct Cfg {
+    std::string testStr;
+    Node testNode;
+    std::vector<Node> testNodes;
+};
+
+} //namespace test_readerinstantiation
+
+FIGCONE_DECLARE_READER(test_readerinstantiation::Cfg);
+
+namespace test_readerinstantiation {
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+TEST(StaticReflTestReaderInstantiation, Read)
+{
+    ///testStr = Hello
+    ///[testNode]
+    ///  testInt = 1
+    ///[[testNodes]]
+    ///  testInt = 2
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("testStr", "Hello", {1, 1});
+    tree->asItem().addNode("testNode", {2, 1}).asItem().addParam("testInt", "1", {3, 3});
+    auto& testNodes = tree->asItem().addNodeList("testNodes", {4, 1});
+    testNodes.asList().emplaceBack({4, 1}).asItem().addParam("testInt", "2", {5, 3});
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.testStr, "Hello");
+    EXPECT_EQ(cfg.testNode.testInt, 1);
+    ASSERT_EQ(cfg.testNodes.size(), 1);
+    EXPECT_EQ(cfg.testNodes[0].testInt, 2);
+}
+
+} //namespace test_readerinstantiation
+
+FIGCONE_DEFINE_READER(test_readerinstantiation::Cfg);
@@ -0,0 +1,101 @@
+#include <figcone/configreader.h>
+#include <figcone/readobserver.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace test_readobserver {
+
+struct Node {
+    int testInt;
+};
+
+struct ListNode {
+    std::string testStr;
+};
+
+struct Cfg {
+    std::string testStr;
+    Node testNode;
+    std::vector<ListNode> testNodes;
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+class RecordingObserver : public figcone::IReadObserver {
+public:
+    void onPhaseBegin(const figcone::ReadPhaseInfo& phaseInfo) override
+    {
+        events.emplace_back("begin " + describe(phaseInfo));
+    }
+
+    void onPhaseEnd(const figcone::ReadPhaseInfo& phaseInfo) override
+    {
+        events.emplace_back("end " + describe(phaseInfo));
+    }
+
+    std::vector<std::string> events;
+
+private:
+    static std::string describe(const figcone::ReadPhaseInfo& phaseInfo)
+    {
+        auto result = std::string{figcone::readPhaseName(phaseInfo.phase)};
+        if (!phaseInfo.name.empty())
+            result += " '" + std::string{phaseInfo.name} + "'";
+        return result + " " + std::to_string(phaseInfo.byteCount) + " " + std::to_string(phaseInfo.elementCount);
+    }
+};
+
+TEST(TestReadObserver, ReadPhases)
+{
+    ///testStr = Hello
+    ///[testNode]
+    ///  testInt = 1
+    ///[[testNodes]]
+    ///  testStr = Foo
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("testStr", "Hello", {1, 1});
+    auto& testNode = tree->asItem().addNode("testNode", {2, 1});
+    testNode.asItem().addParam("testInt", "1", {3, 3});
+    auto& testNodes = tree->asItem().addNodeList("testNodes", {4, 1});
+    auto& node = testNodes.asList().emplaceBack({4, 1});
+    node.asItem().addParam("testStr", "Foo", {5, 3});
+
+    auto parser = TreeProvider{std::move(tree)};
+    auto observer = RecordingObserver{};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setReadObserver(&observer);
+    auto cfg = cfgReader.read<Cfg>("content", parser);
+    EXPECT_EQ(cfg.testNode.testInt, 1);
+
+    auto expectedEvents = std::vector<std::string>{
+            "begin parse 7 0",
+            "end parse 7 0",
+            "begin load 0 3",
+            "begin node 'testNode' 0 1",
+            "end node 'testNode' 0 1",
+            "begin node list 'testNodes' 0 1",
+            "begin node list element '0' 0 1",
+            "end node list element '0' 0 1",
+            "end node list 'testNodes' 0 1",
+            "end load 0 3",
+            "begin post-processing 0 0",
+            "end post-processing 0 0"};
+    EXPECT_EQ(observer.events, expectedEvents);
+}
+
+} //namespace test_readobserver
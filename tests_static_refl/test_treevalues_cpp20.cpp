@@ -0,0 +1,84 @@
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace test_treevalues {
+
+struct Cfg {
+    std::string certificate;
+    std::optional<std::string> messageTemplate;
+    std::vector<std::string> templates;
+    std::map<std::string, std::string> snippets;
+};
+
+struct ItemCfg {
+    std::string name;
+    std::string description;
+};
+
+struct CopyListCfg {
+    std::vector<ItemCfg> items;
+
+    using traits = figcone::FieldTraits<figcone::CopyNodeListField<&CopyListCfg::items>>;
+};
+
+std::string largeText(const std::string& line)
+{
+    auto result = std::string{};
+    for (auto i = 0; i < 100; ++i)
+        result += line + "\n";
+    return result;
+}
+
+TEST(StaticReflTestTreeValues, ReadTree)
+{
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("certificate", largeText("MIIDdzCCAl+gAwIBAgIEAgAAuTANBgkqhkiG9w0BAQUFADBaMQswCQYD"), {1, 1});
+    tree->asItem().addParam("messageTemplate", largeText("Hello, {name}!"), {2, 1});
+    tree->asItem().addParamList("templates", {largeText("{header}"), largeText("{footer}")}, {3, 1});
+    auto& snippets = tree->asItem().addNode("snippets", {4, 1});
+    snippets.asItem().addParam("greeting", largeText("Welcome, {name}"), {5, 3});
+    const auto* certificateData = tree->asItem().param("certificate").value().data();
+    const auto* messageTemplateData = tree->asItem().param("messageTemplate").value().data();
+    const auto* templatesData = tree->asItem().param("templates").valueList().data();
+    const auto* greetingData = snippets.asItem().param("greeting").value().data();
+
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.read<Cfg>(figcone::Tree{std::move(tree)});
+
+    EXPECT_EQ(cfg.certificate, largeText("MIIDdzCCAl+gAwIBAgIEAgAAuTANBgkqhkiG9w0BAQUFADBaMQswCQYD"));
+    EXPECT_EQ(cfg.certificate.data(), certificateData);
+    ASSERT_TRUE(cfg.messageTemplate.has_value());
+    EXPECT_EQ(cfg.messageTemplate->data(), messageTemplateData);
+    EXPECT_EQ(cfg.templates, (std::vector<std::string>{largeText("{header}"), largeText("{footer}")}));
+    EXPECT_EQ(cfg.templates.data(), templatesData);
+    ASSERT_EQ(cfg.snippets.size(), 1);
+    EXPECT_EQ(cfg.snippets.at("greeting").data(), greetingData);
+}
+
+TEST(StaticReflTestTreeValues, CopyNodeList)
+{
+    auto tree = figcone::makeTreeRoot();
+    auto& items = tree->asItem().addNodeList("items", {1, 1});
+    auto& item0 = items.asList().emplaceBack({1, 1});
+    item0.asItem().addParam("name", "first", {1, 1});
+    item0.asItem().addParam("description", largeText("copied description"), {1, 1});
+    auto& item1 = items.asList().emplaceBack({1, 1});
+    item1.asItem().addParam("name", "second", {1, 1});
+
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.read<CopyListCfg>(figcone::Tree{std::move(tree)});
+    ASSERT_EQ(cfg.items.size(), 2);
+    EXPECT_EQ(cfg.items.at(0).name, "first");
+    EXPECT_EQ(cfg.items.at(0).description, largeText("copied description"));
+    EXPECT_EQ(cfg.items.at(1).name, "second");
+    EXPECT_EQ(cfg.items.at(1).description, largeText("copied description"));
+}
+
+} //namespace test_treevalues
@@ -0,0 +1,92 @@
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone/errors.h>
+#include <figcone/expected.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace test_tryread {
+
+struct Node {
+    int testInt;
+};
+
+struct Cfg {
+    std::string testStr;
+    Node testNode;
+    std::vector<Node> testNodes;
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+TEST(StaticReflTestTryRead, Value)
+{
+    ///testStr = Hello
+    ///[testNode]
+    ///  testInt = 10
+    ///[[testNodes]]
+    ///  testInt = 20
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("testStr", "Hello", {1, 1});
+    auto& testNode = tree->asItem().addNode("testNode", {2, 1});
+    testNode.asItem().addParam("testInt", "10", {3, 3});
+    auto& testNodes = tree->asItem().addNodeList("testNodes", {4, 1});
+    {
+        auto& node = testNodes.asList().emplaceBack({4, 1});
+        node.asItem().addParam("testInt", "20", {5, 3});
+    }
+
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.tryRead<Cfg>("", parser);
+
+    ASSERT_TRUE(cfg);
+    EXPECT_EQ(cfg->testStr, "Hello");
+    EXPECT_EQ(cfg->testNode.testInt, 10);
+    ASSERT_EQ(cfg->testNodes.size(), 1);
+    EXPECT_EQ(cfg->testNodes[0].testInt, 20);
+}
+
+TEST(StaticReflTestTryRead, Error)
+{
+    ///testStr = Hello
+    ///[testNode]
+    ///  testInt = 10
+    ///[[testNodes]]
+    ///  testInt = hello
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("testStr", "Hello", {1, 1});
+    auto& testNode = tree->asItem().addNode("testNode", {2, 1});
+    testNode.asItem().addParam("testInt", "10", {3, 3});
+    auto& testNodes = tree->asItem().addNodeList("testNodes", {4, 1});
+    {
+        auto& node = testNodes.asList().emplaceBack({4, 1});
+        node.asItem().addParam("testInt", "hello", {5, 3});
+    }
+
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.tryRead<Cfg>("", parser);
+
+    ASSERT_FALSE(cfg.has_value());
+    EXPECT_EQ(
+            std::string{cfg.error().what()},
+            "[line:5, column:3] Couldn't set parameter 'testInt' value from 'hello'");
+}
+
+} //namespace test_tryread
@@ -0,0 +1,124 @@
+#include "assert_exception.h"
+#include <figcone/configreader.h>
+#include <figcone/errors.h>
+#include <figcone/validators.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <array>
+#include <string>
+#include <vector>
+
+namespace test_validators {
+
+static constexpr auto logLevels = std::array{"debug", "info", "error"};
+
+struct Cfg {
+    int threads;
+    std::string logLevel;
+    std::vector<int> ports;
+
+    using traits = figcone::FieldTraits<
+            figcone::ValidatedField<&Cfg::threads, figcone::validator::InRange<1, 16>>,
+            figcone::ValidatedField<&Cfg::logLevel, figcone::validator::OneOf<logLevels>>,
+            figcone::ValidatedField<&Cfg::ports, figcone::validator::Unique>>;
+};
+
+struct RatioCfg {
+    double ratio;
+
+    using traits = figcone::FieldTraits<figcone::ValidatedField<&RatioCfg::ratio, figcone::validator::Max<0.5>>>;
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+std::unique_ptr<figcone::TreeNode> makeTree(const std::string& threads, const std::vector<std::string>& ports)
+{
+    ///threads = <threads>
+    ///logLevel = info
+    ///ports = <ports>
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("threads", threads, {1, 1});
+    tree->asItem().addParam("logLevel", "info", {2, 1});
+    tree->asItem().addParamList("ports", ports, {3, 1});
+    return tree;
+}
+
+TEST(StaticReflTestValidators, Success)
+{
+    auto parser = TreeProvider{makeTree("4", {"80", "443"})};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.threads, 4);
+    EXPECT_EQ(cfg.logLevel, "info");
+    EXPECT_EQ(cfg.ports, (std::vector<int>{80, 443}));
+}
+
+TEST(StaticReflTestValidators, InRangeError)
+{
+    auto parser = TreeProvider{makeTree("0", {"80", "443"})};
+    auto cfgReader = figcone::ConfigReader{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.read<Cfg>("", parser);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "[line:1, column:1] Parameter 'threads': value must be in range [1, 16]");
+            });
+}
+
+TEST(StaticReflTestValidators, UniqueError)
+{
+    auto parser = TreeProvider{makeTree("4", {"80", "80"})};
+    auto cfgReader = figcone::ConfigReader{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.read<Cfg>("", parser);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "[line:3, column:1] Parameter list 'ports': list elements must be unique, '80' is repeated");
+            });
+}
+
+TEST(StaticReflTestValidators, FloatingPointBound)
+{
+    ///ratio = 0.75
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("ratio", "0.75", {1, 1});
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.read<RatioCfg>("", parser);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "[line:1, column:1] Parameter 'ratio': value can't be greater than 0.5");
+            });
+}
+
+} //namespace test_validators